@@ -12,6 +12,7 @@
  */
 #include "postgres.h"
 
+#include <float.h>
 #include <limits.h>
 
 #include "access/parallel.h"
@@ -20,6 +21,7 @@
 #include "commands/explain_state.h"
 #include "common/pg_prng.h"
 #include "executor/instrument.h"
+#include "nodes/nodeFuncs.h"
 #include "utils/guc.h"
 
 PG_MODULE_MAGIC_EXT(
@@ -41,6 +43,7 @@ static int	auto_explain_log_format = EXPLAIN_FORMAT_TEXT;
 static int	auto_explain_log_level = LOG;
 static bool auto_explain_log_nested_statements = false;
 static double auto_explain_sample_rate = 1;
+static double auto_explain_log_min_error_ratio = 0;	/* 0 = disabled */
 
 static const struct config_enum_entry format_options[] = {
 	{"text", EXPLAIN_FORMAT_TEXT, false},
@@ -87,6 +90,7 @@ static void explain_ExecutorRun(QueryDesc *queryDesc,
 								uint64 count);
 static void explain_ExecutorFinish(QueryDesc *queryDesc);
 static void explain_ExecutorEnd(QueryDesc *queryDesc);
+static bool misestimate_walker(PlanState *planstate, void *context);
 
 
 /*
@@ -245,6 +249,19 @@ _PG_init(void)
 							 NULL,
 							 NULL);
 
+	DefineCustomRealVariable("auto_explain.log_min_error_ratio",
+							 "Log plans containing a row-count misestimate of at least this factor.",
+							 "Zero disables misestimate-based logging.",
+							 &auto_explain_log_min_error_ratio,
+							 0.0,
+							 0.0,
+							 DBL_MAX,
+							 PGC_SUSET,
+							 0,
+							 NULL,
+							 NULL,
+							 NULL);
+
 	MarkGUCPrefixReserved("auto_explain");
 
 	/* Install hooks. */
@@ -374,6 +391,7 @@ explain_ExecutorEnd(QueryDesc *queryDesc)
 	{
 		MemoryContext oldcxt;
 		double		msec;
+		bool		log_plan;
 
 		/*
 		 * Make sure we operate in the per-query context, so any cruft will be
@@ -389,7 +407,23 @@ explain_ExecutorEnd(QueryDesc *queryDesc)
 
 		/* Log plan if duration is exceeded. */
 		msec = queryDesc->totaltime->total * 1000.0;
-		if (msec >= auto_explain_log_min_duration)
+		log_plan = (msec >= auto_explain_log_min_duration);
+
+		/*
+		 * Otherwise, log it anyway if it contains a bad-enough row count
+		 * misestimate.  This needs per-node instrumentation, so it works only
+		 * with log_analyze.
+		 */
+		if (!log_plan && auto_explain_log_min_error_ratio > 0 &&
+			queryDesc->instrument_options && auto_explain_log_analyze)
+		{
+			double		worst_ratio = 0;
+
+			misestimate_walker(queryDesc->planstate, &worst_ratio);
+			log_plan = (worst_ratio >= auto_explain_log_min_error_ratio);
+		}
+
+		if (log_plan)
 		{
 			ExplainState *es = NewExplainState();
 
@@ -445,3 +479,48 @@ explain_ExecutorEnd(QueryDesc *queryDesc)
 	else
 		standard_ExecutorEnd(queryDesc);
 }
+
+/*
+ * Recursively determine the worst per-node row-count misestimate in the
+ * plan tree, expressed as a factor >= 1 (estimated over actual rows, or
+ * vice versa, whichever is larger).  "context" points to a double holding
+ * the worst factor seen so far.
+ *
+ * Nodes that were never executed are ignored; we cannot tell whether their
+ * estimates were any good, and they did not influence the run time.
+ */
+static bool
+misestimate_walker(PlanState *planstate, void *context)
+{
+	double	   *worst_ratio = (double *) context;
+	Instrumentation *instr = planstate->instrument;
+
+	if (instr != NULL)
+	{
+		/* Make sure the counters are up to date (this is idempotent) */
+		InstrEndLoop(instr);
+
+		if (instr->nloops > 0)
+		{
+			double		estimated;
+			double		actual;
+			double		ratio;
+
+			/*
+			 * plan_rows is a per-loop estimate; scale it by the actual loop
+			 * count to compare with the total row count.  Clamp both sides
+			 * to 1 so that "estimated 1, got 0" doesn't divide by zero or
+			 * count as a misestimate.
+			 */
+			estimated = Max(planstate->plan->plan_rows * instr->nloops, 1);
+			actual = Max(instr->ntuples, 1);
+			ratio = (estimated > actual) ?
+				estimated / actual : actual / estimated;
+
+			if (ratio > *worst_ratio)
+				*worst_ratio = ratio;
+		}
+	}
+
+	return planstate_tree_walker(planstate, misestimate_walker, context);
+}
@@ -172,6 +172,35 @@ like(
 	qr/"Node Type": "Index Scan"[^}]*"Index Name": "pg_class_relname_nsp_index"/s,
 	"index scan logged, json mode");
 
+# Misestimate-based logging.  A threshold of 1 is reached by any executed
+# plan, so the query is logged despite not exceeding log_min_duration.
+$log_contents = query_log(
+	$node,
+	"SELECT * FROM pg_class;",
+	{
+		"auto_explain.log_min_duration" => "10s",
+		"auto_explain.log_min_error_ratio" => 1
+	});
+
+like(
+	$log_contents,
+	qr/Seq Scan on pg_class/,
+	"plan logged by log_min_error_ratio");
+
+# With the threshold disabled, the same query is not logged.
+$log_contents = query_log(
+	$node,
+	"SELECT * FROM pg_class;",
+	{
+		"auto_explain.log_min_duration" => "10s",
+		"auto_explain.log_min_error_ratio" => 0
+	});
+
+unlike(
+	$log_contents,
+	qr/Seq Scan on pg_class/,
+	"plan not logged with log_min_error_ratio disabled");
+
 # Check that PGC_SUSET parameters can be set by non-superuser if granted,
 # otherwise not
 
@@ -59,8 +59,22 @@ typedef struct BlockInfoRecord
 	RelFileNumber filenumber;
 	ForkNumber	forknum;
 	BlockNumber blocknum;
+	uint16		usage_count;	/* buffer usage count at dump time */
 } BlockInfoRecord;
 
+/*
+ * Range of BlockInfoRecords belonging to one database (possibly including
+ * global objects), used to decide the order in which databases are
+ * prewarmed.
+ */
+typedef struct DatabaseRangeRecord
+{
+	Oid			database;
+	int			start_idx;		/* first index in the block info array */
+	int			stop_idx;		/* index past the last one */
+	uint64		total_usage;	/* sum of usage counts in the range */
+} DatabaseRangeRecord;
+
 /* Shared state information for autoprewarm bgworker. */
 typedef struct AutoPrewarmSharedState
 {
@@ -111,6 +125,8 @@ static void apw_start_database_worker(void);
 static bool apw_init_shmem(void);
 static void apw_detach_shmem(int code, Datum arg);
 static int	apw_compare_blockinfo(const void *p, const void *q);
+static int	apw_compare_usage(const void *p, const void *q);
+static int	apw_compare_database_usage(const void *p, const void *q);
 
 /* Pointer to shared-memory state. */
 static AutoPrewarmSharedState *apw_state = NULL;
@@ -295,6 +311,9 @@ apw_load_buffers(void)
 	int			num_elements,
 				i;
 	BlockInfoRecord *blkinfo;
+	DatabaseRangeRecord *ranges;
+	int			num_ranges = 0;
+	int			maxranges;
 	dsm_segment *seg;
 
 	/*
@@ -349,47 +368,71 @@ apw_load_buffers(void)
 	for (i = 0; i < num_elements; i++)
 	{
 		unsigned	forknum;
+		unsigned	usage_count;
+		int			nfields;
 
-		if (fscanf(file, "%u,%u,%u,%u,%u\n", &blkinfo[i].database,
-				   &blkinfo[i].tablespace, &blkinfo[i].filenumber,
-				   &forknum, &blkinfo[i].blocknum) != 5)
+		nfields = fscanf(file, "%u,%u,%u,%u,%u,%u\n", &blkinfo[i].database,
+						 &blkinfo[i].tablespace, &blkinfo[i].filenumber,
+						 &forknum, &blkinfo[i].blocknum, &usage_count);
+		if (nfields == 5)
+		{
+			/* Dump file from a version that predates usage counts. */
+			usage_count = 1;
+		}
+		else if (nfields != 6)
 			ereport(ERROR,
 					(errmsg("autoprewarm block dump file is corrupted at line %d",
 							i + 1)));
 		blkinfo[i].forknum = forknum;
+		blkinfo[i].usage_count = usage_count;
 	}
 
 	FreeFile(file);
 
-	/* Sort the blocks to be loaded. */
-	qsort(blkinfo, num_elements, sizeof(BlockInfoRecord),
-		  apw_compare_blockinfo);
-
-	/* Populate shared memory state. */
-	apw_state->block_info_handle = dsm_segment_handle(seg);
-	apw_state->prewarm_start_idx = apw_state->prewarm_stop_idx = 0;
-	apw_state->prewarmed_blocks = 0;
-
-	/* Don't prewarm more than we can fit. */
+	/*
+	 * Don't prewarm more than we can fit.  Prefer the most frequently used
+	 * blocks, per the usage counts recorded at dump time, so that a smaller
+	 * shared_buffers still ends up holding the hottest part of the previous
+	 * working set.
+	 */
 	if (num_elements > NBuffers)
 	{
+		qsort(blkinfo, num_elements, sizeof(BlockInfoRecord),
+			  apw_compare_usage);
 		num_elements = NBuffers;
 		ereport(LOG,
 				(errmsg("autoprewarm capping prewarmed blocks to %d (shared_buffers size)",
 						NBuffers)));
 	}
 
-	/* Get the info position of the first block of the next database. */
-	while (apw_state->prewarm_start_idx < num_elements)
+	/*
+	 * Sort the blocks to be loaded.  Note that we keep blocks of a database
+	 * grouped and in block-number order rather than ordering them by usage
+	 * count; a frequency-ordered read would be essentially random I/O and
+	 * defeat the read stream's ability to combine reads.
+	 */
+	qsort(blkinfo, num_elements, sizeof(BlockInfoRecord),
+		  apw_compare_blockinfo);
+
+	/* Populate shared memory state. */
+	apw_state->block_info_handle = dsm_segment_handle(seg);
+	apw_state->prewarm_start_idx = apw_state->prewarm_stop_idx = 0;
+	apw_state->prewarmed_blocks = 0;
+
+	/* Collect the range of BlockInfoRecords for each database. */
+	maxranges = 8;
+	ranges = palloc(sizeof(DatabaseRangeRecord) * maxranges);
+	i = 0;
+	while (i < num_elements)
 	{
-		int			j = apw_state->prewarm_start_idx;
-		Oid			current_db = blkinfo[j].database;
+		Oid			current_db = blkinfo[i].database;
+		uint64		total_usage = blkinfo[i].usage_count;
+		int			j = i + 1;
 
 		/*
-		 * Advance the prewarm_stop_idx to the first BlockInfoRecord that does
-		 * not belong to this database.
+		 * Advance j to the first BlockInfoRecord that does not belong to
+		 * this database.
 		 */
-		j++;
 		while (j < num_elements)
 		{
 			if (current_db != blkinfo[j].database)
@@ -403,39 +446,64 @@ apw_load_buffers(void)
 				current_db = blkinfo[j].database;
 			}
 
+			total_usage += blkinfo[j].usage_count;
 			j++;
 		}
 
 		/*
 		 * If we reach this point with current_db == InvalidOid, then only
 		 * BlockInfoRecords belonging to global objects exist.  We can't
-		 * prewarm without a database connection, so just bail out.
+		 * prewarm without a database connection, so skip such a range.
 		 */
-		if (current_db == InvalidOid)
-			break;
+		if (current_db != InvalidOid)
+		{
+			if (num_ranges >= maxranges)
+			{
+				maxranges *= 2;
+				ranges = repalloc(ranges,
+								  sizeof(DatabaseRangeRecord) * maxranges);
+			}
+			ranges[num_ranges].database = current_db;
+			ranges[num_ranges].start_idx = i;
+			ranges[num_ranges].stop_idx = j;
+			ranges[num_ranges].total_usage = total_usage;
+			num_ranges++;
+		}
 
-		/* Configure stop point and database for next per-database worker. */
-		apw_state->prewarm_stop_idx = j;
-		apw_state->database = current_db;
-		Assert(apw_state->prewarm_start_idx < apw_state->prewarm_stop_idx);
+		i = j;
+	}
+
+	/*
+	 * Prewarm the most heavily used databases first, so that a shutdown
+	 * arriving mid-prewarm still leaves us with the hottest data restored.
+	 */
+	qsort(ranges, num_ranges, sizeof(DatabaseRangeRecord),
+		  apw_compare_database_usage);
 
+	for (i = 0; i < num_ranges; i++)
+	{
 		/*
-		 * Likewise, don't launch if we've already been told to shut down.
-		 * (The launch would fail anyway, but we might as well skip it.)
+		 * Don't launch if we've already been told to shut down.  (The launch
+		 * would fail anyway, but we might as well skip it.)
 		 */
 		if (ShutdownRequestPending)
 			break;
 
+		/* Configure block range and database for next per-database worker. */
+		apw_state->prewarm_start_idx = ranges[i].start_idx;
+		apw_state->prewarm_stop_idx = ranges[i].stop_idx;
+		apw_state->database = ranges[i].database;
+		Assert(apw_state->prewarm_start_idx < apw_state->prewarm_stop_idx);
+
 		/*
 		 * Start a per-database worker to load blocks for this database; this
 		 * function will return once the per-database worker exits.
 		 */
 		apw_start_database_worker();
-
-		/* Prepare for next database. */
-		apw_state->prewarm_start_idx = apw_state->prewarm_stop_idx;
 	}
 
+	pfree(ranges);
+
 	/* Clean up. */
 	dsm_detach(seg);
 	LWLockAcquire(&apw_state->lock, LW_EXCLUSIVE);
@@ -727,6 +795,8 @@ apw_dump_now(bool is_bgworker, bool dump_unlogged)
 			block_info_array[num_blocks].forknum =
 				BufTagGetForkNum(&bufHdr->tag);
 			block_info_array[num_blocks].blocknum = bufHdr->tag.blockNum;
+			block_info_array[num_blocks].usage_count =
+				BUF_STATE_GET_USAGECOUNT(buf_state);
 			++num_blocks;
 		}
 
@@ -759,12 +829,13 @@ apw_dump_now(bool is_bgworker, bool dump_unlogged)
 	{
 		CHECK_FOR_INTERRUPTS();
 
-		ret = fprintf(file, "%u,%u,%u,%u,%u\n",
+		ret = fprintf(file, "%u,%u,%u,%u,%u,%u\n",
 					  block_info_array[i].database,
 					  block_info_array[i].tablespace,
 					  block_info_array[i].filenumber,
 					  (uint32) block_info_array[i].forknum,
-					  block_info_array[i].blocknum);
+					  block_info_array[i].blocknum,
+					  (uint32) block_info_array[i].usage_count);
 		if (ret < 0)
 		{
 			int			save_errno = errno;
@@ -1006,3 +1077,44 @@ apw_compare_blockinfo(const void *p, const void *q)
 
 	return 0;
 }
+
+/*
+ * apw_compare_usage
+ *
+ * Sort blocks by descending usage count, so that when the dump contains
+ * more blocks than shared_buffers can hold we keep the most frequently
+ * used ones.
+ */
+static int
+apw_compare_usage(const void *p, const void *q)
+{
+	const BlockInfoRecord *a = (const BlockInfoRecord *) p;
+	const BlockInfoRecord *b = (const BlockInfoRecord *) q;
+
+	if (a->usage_count > b->usage_count)
+		return -1;
+	else if (a->usage_count < b->usage_count)
+		return 1;
+
+	return 0;
+}
+
+/*
+ * apw_compare_database_usage
+ *
+ * Sort per-database ranges by descending total usage count, so that the
+ * most heavily used databases are prewarmed first.
+ */
+static int
+apw_compare_database_usage(const void *p, const void *q)
+{
+	const DatabaseRangeRecord *a = (const DatabaseRangeRecord *) p;
+	const DatabaseRangeRecord *b = (const DatabaseRangeRecord *) q;
+
+	if (a->total_usage > b->total_usage)
+		return -1;
+	else if (a->total_usage < b->total_usage)
+		return 1;
+
+	return 0;
+}
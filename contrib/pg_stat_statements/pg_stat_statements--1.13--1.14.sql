@@ -0,0 +1,22 @@
+/* contrib/pg_stat_statements/pg_stat_statements--1.13--1.14.sql */
+
+-- complain if script is sourced in psql, rather than via ALTER EXTENSION
+\echo Use "ALTER EXTENSION pg_stat_statements UPDATE TO '1.14'" to load this file. \quit
+
+CREATE FUNCTION pg_stat_statements_node_stats(
+    OUT userid oid,
+    OUT dbid oid,
+    OUT toplevel bool,
+    OUT queryid bigint,
+    OUT node_class text,
+    OUT total_exec_time float8,
+    OUT rows int8,
+    OUT loops int8,
+    OUT shared_blks_hit int8,
+    OUT shared_blks_read int8
+)
+RETURNS SETOF record
+AS 'MODULE_PATHNAME', 'pg_stat_statements_node_stats'
+LANGUAGE C STRICT VOLATILE PARALLEL SAFE;
+
+GRANT EXECUTE ON FUNCTION pg_stat_statements_node_stats() TO PUBLIC;
@@ -56,6 +56,7 @@
 #include "jit/jit.h"
 #include "mb/pg_wchar.h"
 #include "miscadmin.h"
+#include "nodes/nodeFuncs.h"
 #include "nodes/queryjumble.h"
 #include "optimizer/planner.h"
 #include "parser/analyze.h"
@@ -86,7 +87,7 @@ PG_MODULE_MAGIC_EXT(
 #define PGSS_TEXT_FILE	PG_STAT_TMP_DIR "/pgss_query_texts.stat"
 
 /* Magic number identifying the stats file format */
-static const uint32 PGSS_FILE_HEADER = 0x20250731;
+static const uint32 PGSS_FILE_HEADER = 0x20260830;
 
 /* PostgreSQL major version number, changes in which invalidate all entries */
 static const uint32 PGSS_PG_MAJOR_VERSION = PG_VERSION_NUM / 100;
@@ -149,6 +150,46 @@ typedef struct pgssHashKey
 	bool		toplevel;		/* query executed at top level */
 } pgssHashKey;
 
+/*
+ * Plan node classes that per-node statistics are aggregated by, when
+ * pg_stat_statements.track_nodes is enabled.  Per-node-type detail would
+ * make entries unreasonably wide; these classes are coarse enough to answer
+ * "where does this query's execution time go" without that.
+ */
+typedef enum pgssNodeClass
+{
+	PGSS_NODE_SCAN = 0,
+	PGSS_NODE_JOIN,
+	PGSS_NODE_SORT,
+	PGSS_NODE_AGGREGATE,
+	PGSS_NODE_MODIFY,
+	PGSS_NODE_OTHER,
+	PGSS_NUMNODECLASS			/* must be last */
+} pgssNodeClass;
+
+static const char *const pgss_node_class_names[] = {
+	"scan",
+	"join",
+	"sort",
+	"aggregate",
+	"modify",
+	"other",
+};
+
+/*
+ * Per-node-class statistics, accumulated from each plan node's
+ * Instrumentation at ExecutorEnd.  Node times are inclusive of children, as
+ * in EXPLAIN ANALYZE.
+ */
+typedef struct pgssNodeUsage
+{
+	double		total_time;		/* total execution time, in msec */
+	int64		rows;			/* total # of rows emitted */
+	int64		loops;			/* total # of executions of the node */
+	int64		shared_blks_hit;	/* # of shared buffer hits */
+	int64		shared_blks_read;	/* # of shared disk blocks read */
+} pgssNodeUsage;
+
 /*
  * The actual stats counters kept within pgssEntry.
  */
@@ -213,6 +254,8 @@ typedef struct Counters
 											 * launched */
 	int64		generic_plan_calls; /* number of calls using a generic plan */
 	int64		custom_plan_calls;	/* number of calls using a custom plan */
+	pgssNodeUsage nodes[PGSS_NUMNODECLASS]; /* per-node-class statistics,
+											 * filled only under track_nodes */
 } Counters;
 
 /*
@@ -298,6 +341,8 @@ static const struct config_enum_entry track_options[] =
 static int	pgss_max = 5000;	/* max # statements to track */
 static int	pgss_track = PGSS_TRACK_TOP;	/* tracking level */
 static bool pgss_track_utility = true;	/* whether to track utility commands */
+static bool pgss_track_nodes = false;	/* whether to track per-node-class
+										 * statistics */
 static bool pgss_track_planning = false;	/* whether to track planning
 											 * duration */
 static bool pgss_save = true;	/* whether to save stats across shutdown */
@@ -329,6 +374,7 @@ PG_FUNCTION_INFO_V1(pg_stat_statements_1_12);
 PG_FUNCTION_INFO_V1(pg_stat_statements_1_13);
 PG_FUNCTION_INFO_V1(pg_stat_statements);
 PG_FUNCTION_INFO_V1(pg_stat_statements_info);
+PG_FUNCTION_INFO_V1(pg_stat_statements_node_stats);
 
 static void pgss_shmem_request(void);
 static void pgss_shmem_startup(void);
@@ -351,6 +397,7 @@ static void pgss_ProcessUtility(PlannedStmt *pstmt, const char *queryString,
 								ProcessUtilityContext context, ParamListInfo params,
 								QueryEnvironment *queryEnv,
 								DestReceiver *dest, QueryCompletion *qc);
+static bool pgss_node_usage_walker(PlanState *planstate, void *context);
 static void pgss_store(const char *query, int64 queryId,
 					   int query_location, int query_len,
 					   pgssStoreKind kind,
@@ -358,6 +405,7 @@ static void pgss_store(const char *query, int64 queryId,
 					   const BufferUsage *bufusage,
 					   const WalUsage *walusage,
 					   const struct JitInstrumentation *jitusage,
+					   const pgssNodeUsage *nodeusage,
 					   JumbleState *jstate,
 					   int parallel_workers_to_launch,
 					   int parallel_workers_launched,
@@ -457,6 +505,17 @@ _PG_init(void)
 							 NULL,
 							 NULL);
 
+	DefineCustomBoolVariable("pg_stat_statements.track_nodes",
+							 "Selects whether per-plan-node-class statistics are tracked by pg_stat_statements.",
+							 "Enabling this instruments every plan node, which adds per-tuple timing overhead.",
+							 &pgss_track_nodes,
+							 false,
+							 PGC_SUSET,
+							 0,
+							 NULL,
+							 NULL,
+							 NULL);
+
 	DefineCustomBoolVariable("pg_stat_statements.save",
 							 "Save pg_stat_statements statistics across server shutdowns.",
 							 NULL,
@@ -881,6 +940,7 @@ pgss_post_parse_analyze(ParseState *pstate, Query *query, JumbleState *jstate)
 				   NULL,
 				   NULL,
 				   NULL,
+				   NULL,
 				   jstate,
 				   0,
 				   0,
@@ -964,6 +1024,7 @@ pgss_planner(Query *parse,
 				   &walusage,
 				   NULL,
 				   NULL,
+				   NULL,
 				   0,
 				   0,
 				   result->planOrigin);
@@ -1001,6 +1062,14 @@ pgss_planner(Query *parse,
 static void
 pgss_ExecutorStart(QueryDesc *queryDesc, int eflags)
 {
+	/*
+	 * If we're going to collect per-node-class statistics, request per-node
+	 * instrumentation before the executor builds the planstate tree.
+	 */
+	if (pgss_track_nodes && pgss_enabled(nesting_level) &&
+		queryDesc->plannedstmt->queryId != INT64CONST(0))
+		queryDesc->instrument_options |= INSTRUMENT_TIMER | INSTRUMENT_BUFFERS;
+
 	if (prev_ExecutorStart)
 		prev_ExecutorStart(queryDesc, eflags);
 	else
@@ -1071,6 +1140,85 @@ pgss_ExecutorFinish(QueryDesc *queryDesc)
 	PG_END_TRY();
 }
 
+/*
+ * Classify a plan node for per-node-class statistics.
+ */
+static pgssNodeClass
+pgss_node_class(Plan *plan)
+{
+	switch (nodeTag(plan))
+	{
+		case T_SeqScan:
+		case T_SampleScan:
+		case T_IndexScan:
+		case T_IndexOnlyScan:
+		case T_BitmapIndexScan:
+		case T_BitmapHeapScan:
+		case T_TidScan:
+		case T_TidRangeScan:
+		case T_SubqueryScan:
+		case T_FunctionScan:
+		case T_ValuesScan:
+		case T_TableFuncScan:
+		case T_CteScan:
+		case T_NamedTuplestoreScan:
+		case T_WorkTableScan:
+		case T_ForeignScan:
+		case T_CustomScan:
+			return PGSS_NODE_SCAN;
+
+		case T_NestLoop:
+		case T_MergeJoin:
+		case T_HashJoin:
+		case T_Hash:			/* only exists under a hash join */
+			return PGSS_NODE_JOIN;
+
+		case T_Sort:
+		case T_IncrementalSort:
+			return PGSS_NODE_SORT;
+
+		case T_Agg:
+		case T_Group:
+		case T_WindowAgg:
+		case T_SetOp:
+			return PGSS_NODE_AGGREGATE;
+
+		case T_ModifyTable:
+			return PGSS_NODE_MODIFY;
+
+		default:
+			return PGSS_NODE_OTHER;
+	}
+}
+
+/*
+ * Walk the planstate tree, summing each node's instrumentation into the
+ * pgssNodeUsage array that 'context' points to.  As in EXPLAIN ANALYZE, a
+ * node's time and buffer counts include its children, so sums across classes
+ * overlap; the numbers answer "how much work ran under nodes of this class",
+ * not "how do the classes partition total time".
+ */
+static bool
+pgss_node_usage_walker(PlanState *planstate, void *context)
+{
+	pgssNodeUsage *nodes = (pgssNodeUsage *) context;
+	Instrumentation *instr = planstate->instrument;
+
+	if (instr != NULL)
+	{
+		pgssNodeUsage *usage = &nodes[pgss_node_class(planstate->plan)];
+
+		InstrEndLoop(instr);
+		usage->total_time += instr->total * 1000.0; /* convert to msec */
+		usage->rows += (int64) instr->ntuples;
+		usage->loops += (int64) instr->nloops;
+		usage->shared_blks_hit += instr->bufusage.shared_blks_hit;
+		usage->shared_blks_read += instr->bufusage.shared_blks_read;
+	}
+
+	return planstate_tree_walker(planstate, pgss_node_usage_walker, context);
+}
+
 /*
  * ExecutorEnd hook: store results if needed
  */
@@ -1082,12 +1230,28 @@ pgss_ExecutorEnd(QueryDesc *queryDesc)
 	if (queryId != INT64CONST(0) && queryDesc->totaltime &&
 		pgss_enabled(nesting_level))
 	{
+		pgssNodeUsage nodeusage[PGSS_NUMNODECLASS];
+		const pgssNodeUsage *nodes = NULL;
+
 		/*
 		 * Make sure stats accumulation is done.  (Note: it's okay if several
 		 * levels of hook all do this.)
 		 */
 		InstrEndLoop(queryDesc->totaltime);
 
+		/*
+		 * Sum up the per-node instrumentation, if we requested it in
+		 * pgss_ExecutorStart.  (track_nodes may have been turned on since
+		 * then, so check the instrumentation options, not the GUC.)
+		 */
+		if (pgss_track_nodes && queryDesc->planstate &&
+			(queryDesc->instrument_options & INSTRUMENT_TIMER))
+		{
+			memset(nodeusage, 0, sizeof(nodeusage));
+			pgss_node_usage_walker(queryDesc->planstate, nodeusage);
+			nodes = nodeusage;
+		}
+
 		pgss_store(queryDesc->sourceText,
 				   queryId,
 				   queryDesc->plannedstmt->stmt_location,
@@ -1098,6 +1262,7 @@ pgss_ExecutorEnd(QueryDesc *queryDesc)
 				   &queryDesc->totaltime->bufusage,
 				   &queryDesc->totaltime->walusage,
 				   queryDesc->estate->es_jit ? &queryDesc->estate->es_jit->instr : NULL,
+				   nodes,
 				   NULL,
 				   queryDesc->estate->es_parallel_workers_to_launch,
 				   queryDesc->estate->es_parallel_workers_launched,
@@ -1233,6 +1398,7 @@ pgss_ProcessUtility(PlannedStmt *pstmt, const char *queryString,
 				   &walusage,
 				   NULL,
 				   NULL,
+				   NULL,
 				   0,
 				   0,
 				   pstmt->planOrigin);
@@ -1296,6 +1462,7 @@ pgss_store(const char *query, int64 queryId,
 		   const BufferUsage *bufusage,
 		   const WalUsage *walusage,
 		   const struct JitInstrumentation *jitusage,
+		   const pgssNodeUsage *nodeusage,
 		   JumbleState *jstate,
 		   int parallel_workers_to_launch,
 		   int parallel_workers_launched,
@@ -1503,6 +1670,18 @@ pgss_store(const char *query, int64 queryId,
 			entry->counters.jit_emission_time += INSTR_TIME_GET_MILLISEC(jitusage->emission_counter);
 		}
 
+		if (nodeusage)
+		{
+			for (int i = 0; i < PGSS_NUMNODECLASS; i++)
+			{
+				entry->counters.nodes[i].total_time += nodeusage[i].total_time;
+				entry->counters.nodes[i].rows += nodeusage[i].rows;
+				entry->counters.nodes[i].loops += nodeusage[i].loops;
+				entry->counters.nodes[i].shared_blks_hit += nodeusage[i].shared_blks_hit;
+				entry->counters.nodes[i].shared_blks_read += nodeusage[i].shared_blks_read;
+			}
+		}
+
 		/* parallel worker counters */
 		entry->counters.parallel_workers_to_launch += parallel_workers_to_launch;
 		entry->counters.parallel_workers_launched += parallel_workers_launched;
@@ -2082,6 +2261,73 @@ pg_stat_statements_info(PG_FUNCTION_ARGS)
 	PG_RETURN_DATUM(HeapTupleGetDatum(heap_form_tuple(tupdesc, values, nulls)));
 }
 
+/* Number of output arguments (columns) for pg_stat_statements_node_stats */
+#define PG_STAT_STATEMENTS_NODE_COLS	10
+
+/*
+ * Return per-node-class statistics, one row per (statement, node class)
+ * that has accumulated anything.  Rows only accumulate while
+ * pg_stat_statements.track_nodes is enabled.
+ */
+Datum
+pg_stat_statements_node_stats(PG_FUNCTION_ARGS)
+{
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	HASH_SEQ_STATUS hash_seq;
+	pgssEntry  *entry;
+
+	if (!pgss || !pgss_hash)
+		ereport(ERROR,
+				(errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
+				 errmsg("pg_stat_statements must be loaded via \"shared_preload_libraries\"")));
+
+	InitMaterializedSRF(fcinfo, 0);
+
+	LWLockAcquire(pgss->lock, LW_SHARED);
+
+	hash_seq_init(&hash_seq, pgss_hash);
+	while ((entry = hash_seq_search(&hash_seq)) != NULL)
+	{
+		pgssNodeUsage nodes[PGSS_NUMNODECLASS];
+
+		/* copy counters to a local variable to keep locking time short */
+		{
+			volatile pgssEntry *e = (volatile pgssEntry *) entry;
+
+			SpinLockAcquire(&e->mutex);
+			memcpy(nodes, (const void *) e->counters.nodes, sizeof(nodes));
+			SpinLockRelease(&e->mutex);
+		}
+
+		for (int i = 0; i < PGSS_NUMNODECLASS; i++)
+		{
+			Datum		values[PG_STAT_STATEMENTS_NODE_COLS];
+			bool		nulls[PG_STAT_STATEMENTS_NODE_COLS] = {0};
+
+			if (nodes[i].loops == 0)
+				continue;
+
+			values[0] = ObjectIdGetDatum(entry->key.userid);
+			values[1] = ObjectIdGetDatum(entry->key.dbid);
+			values[2] = BoolGetDatum(entry->key.toplevel);
+			values[3] = Int64GetDatum(entry->key.queryid);
+			values[4] = CStringGetTextDatum(pgss_node_class_names[i]);
+			values[5] = Float8GetDatum(nodes[i].total_time);
+			values[6] = Int64GetDatum(nodes[i].rows);
+			values[7] = Int64GetDatum(nodes[i].loops);
+			values[8] = Int64GetDatum(nodes[i].shared_blks_hit);
+			values[9] = Int64GetDatum(nodes[i].shared_blks_read);
+
+			tuplestore_putvalues(rsinfo->setResult, rsinfo->setDesc,
+								 values, nulls);
+		}
+	}
+
+	LWLockRelease(pgss->lock);
+
+	return (Datum) 0;
+}
+
 /*
  * Estimate shared memory space needed.
  */
@@ -68,4 +68,8 @@ AlTER EXTENSION pg_stat_statements UPDATE TO '1.13';
 \d pg_stat_statements
 SELECT count(*) > 0 AS has_data FROM pg_stat_statements;
 
+-- New function pg_stat_statements_node_stats in 1.14
+AlTER EXTENSION pg_stat_statements UPDATE TO '1.14';
+SELECT count(*) >= 0 AS ok FROM pg_stat_statements_node_stats();
+
 DROP EXTENSION pg_stat_statements;
@@ -0,0 +1,23 @@
+/* contrib/pg_wait_profile/pg_wait_profile--1.0.sql */
+
+-- complain if script is sourced in psql, rather than via CREATE EXTENSION
+\echo Use "CREATE EXTENSION pg_wait_profile" to load this file. \quit
+
+CREATE FUNCTION pg_wait_profile(
+    OUT wait_event_type text,
+    OUT wait_event text,
+    OUT count int8
+)
+RETURNS SETOF record
+AS 'MODULE_PATHNAME', 'pg_wait_profile'
+LANGUAGE C PARALLEL SAFE;
+
+CREATE VIEW pg_wait_profile AS
+  SELECT * FROM pg_wait_profile();
+
+GRANT SELECT ON pg_wait_profile TO PUBLIC;
+
+CREATE FUNCTION pg_wait_profile_reset()
+RETURNS void
+AS 'MODULE_PATHNAME', 'pg_wait_profile_reset'
+LANGUAGE C PARALLEL SAFE;
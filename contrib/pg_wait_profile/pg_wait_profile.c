@@ -0,0 +1,318 @@
+/*-------------------------------------------------------------------------
+ *
+ * pg_wait_profile.c
+ *		Sampling profiler for wait events.
+ *
+ * A background worker periodically reads the wait_event_info of every
+ * PGPROC in the system and accumulates a count per wait event in a hash
+ * table in shared memory.  Polling pg_stat_activity from the outside only
+ * catches waits that happen to be in progress at each poll; sampling from
+ * within the server at a fixed frequency turns the counts into a time
+ * profile of where processes spend their blocked time, without needing
+ * external tracing tools.
+ *
+ * The reads of other processes' wait_event_info are unsynchronized.  A
+ * stale or torn value can at worst attribute one sample to the wrong
+ * event, which is acceptable noise for a statistical profiler and avoids
+ * imposing any cost on the processes being sampled.
+ *
+ * Copyright (c) 2025, PostgreSQL Global Development Group
+ *
+ * IDENTIFICATION
+ *	  contrib/pg_wait_profile/pg_wait_profile.c
+ *
+ *-------------------------------------------------------------------------
+ */
+#include "postgres.h"
+
+#include "funcapi.h"
+#include "miscadmin.h"
+#include "postmaster/bgworker.h"
+#include "postmaster/interrupt.h"
+#include "storage/ipc.h"
+#include "storage/latch.h"
+#include "storage/lwlock.h"
+#include "storage/proc.h"
+#include "storage/shmem.h"
+#include "utils/builtins.h"
+#include "utils/guc.h"
+#include "utils/wait_event.h"
+
+PG_MODULE_MAGIC_EXT(
+					.name = "pg_wait_profile",
+					.version = PG_VERSION
+);
+
+/*
+ * More entries than distinct wait events that can ever be reported; if the
+ * table nevertheless fills up, further unseen events are simply not counted.
+ */
+#define PGWP_MAX_ENTRIES	1024
+
+/* Per-wait-event counter in shared memory */
+typedef struct pgwpEntry
+{
+	uint32		wait_event_info;	/* hash key; must be first */
+	int64		count;			/* number of samples attributed to it */
+} pgwpEntry;
+
+/* Global shared state */
+typedef struct pgwpSharedState
+{
+	LWLock	   *lock;			/* protects the hash table */
+} pgwpSharedState;
+
+/* Links to shared memory state */
+static pgwpSharedState *pgwp = NULL;
+static HTAB *pgwp_hash = NULL;
+
+/* Saved hook values */
+static shmem_request_hook_type prev_shmem_request_hook = NULL;
+static shmem_startup_hook_type prev_shmem_startup_hook = NULL;
+
+/* GUC variable */
+static int	pgwp_sample_interval = 10;	/* ms */
+
+PG_FUNCTION_INFO_V1(pg_wait_profile);
+PG_FUNCTION_INFO_V1(pg_wait_profile_reset);
+
+PGDLLEXPORT void pg_wait_profile_main(Datum main_arg);
+
+static void pgwp_shmem_request(void);
+static void pgwp_shmem_startup(void);
+static void pgwp_sample(void);
+
+/*
+ * Module load callback
+ */
+void
+_PG_init(void)
+{
+	BackgroundWorker worker = {0};
+
+	DefineCustomIntVariable("pg_wait_profile.sample_interval",
+							"Sets the interval between wait event samples.",
+							NULL,
+							&pgwp_sample_interval,
+							10,
+							1, 10000,
+							PGC_SIGHUP,
+							GUC_UNIT_MS,
+							NULL,
+							NULL,
+							NULL);
+
+	MarkGUCPrefixReserved("pg_wait_profile");
+
+	/*
+	 * The shared memory and the sampling worker can only be set up when the
+	 * library is preloaded.
+	 */
+	if (!process_shared_preload_libraries_in_progress)
+		return;
+
+	prev_shmem_request_hook = shmem_request_hook;
+	shmem_request_hook = pgwp_shmem_request;
+	prev_shmem_startup_hook = shmem_startup_hook;
+	shmem_startup_hook = pgwp_shmem_startup;
+
+	worker.bgw_flags = BGWORKER_SHMEM_ACCESS;
+	worker.bgw_start_time = BgWorkerStart_ConsistentState;
+	worker.bgw_restart_time = 10;
+	strcpy(worker.bgw_library_name, "pg_wait_profile");
+	strcpy(worker.bgw_function_name, "pg_wait_profile_main");
+	strcpy(worker.bgw_name, "pg_wait_profile sampler");
+	strcpy(worker.bgw_type, "pg_wait_profile sampler");
+	RegisterBackgroundWorker(&worker);
+}
+
+/*
+ * shmem_request hook: request additional shared resources.
+ */
+static void
+pgwp_shmem_request(void)
+{
+	if (prev_shmem_request_hook)
+		prev_shmem_request_hook();
+
+	RequestAddinShmemSpace(MAXALIGN(sizeof(pgwpSharedState)) +
+						   hash_estimate_size(PGWP_MAX_ENTRIES,
+											  sizeof(pgwpEntry)));
+	RequestNamedLWLockTranche("pg_wait_profile", 1);
+}
+
+/*
+ * shmem_startup hook: allocate or attach to shared memory.
+ */
+static void
+pgwp_shmem_startup(void)
+{
+	bool		found;
+	HASHCTL		info;
+
+	if (prev_shmem_startup_hook)
+		prev_shmem_startup_hook();
+
+	/* reset in case this is a restart within the postmaster */
+	pgwp = NULL;
+	pgwp_hash = NULL;
+
+	LWLockAcquire(AddinShmemInitLock, LW_EXCLUSIVE);
+
+	pgwp = ShmemInitStruct("pg_wait_profile",
+						   sizeof(pgwpSharedState),
+						   &found);
+	if (!found)
+		pgwp->lock = &(GetNamedLWLockTranche("pg_wait_profile"))->lock;
+
+	info.keysize = sizeof(uint32);
+	info.entrysize = sizeof(pgwpEntry);
+	pgwp_hash = ShmemInitHash("pg_wait_profile hash",
+							  PGWP_MAX_ENTRIES, PGWP_MAX_ENTRIES,
+							  &info,
+							  HASH_ELEM | HASH_BLOBS);
+
+	LWLockRelease(AddinShmemInitLock);
+}
+
+/*
+ * Take one sample: attribute the current wait event of every process to its
+ * counter.  Processes that are running (not waiting) contribute nothing; the
+ * profile deliberately covers blocked time only.
+ */
+static void
+pgwp_sample(void)
+{
+	LWLockAcquire(pgwp->lock, LW_EXCLUSIVE);
+
+	for (uint32 i = 0; i < ProcGlobal->allProcCount; i++)
+	{
+		PGPROC	   *proc = &ProcGlobal->allProcs[i];
+		uint32		wait_event_info;
+		pgwpEntry  *entry;
+		bool		found;
+
+		if (proc->pid == 0)
+			continue;			/* unused slot */
+
+		wait_event_info = proc->wait_event_info;
+		if (wait_event_info == 0)
+			continue;			/* not waiting */
+
+		entry = hash_search(pgwp_hash, &wait_event_info, HASH_ENTER_NULL,
+							&found);
+		if (entry == NULL)
+			continue;			/* table full; drop the sample */
+		if (!found)
+			entry->count = 0;
+		entry->count++;
+	}
+
+	LWLockRelease(pgwp->lock);
+}
+
+/*
+ * Main entry point of the sampling worker.
+ */
+void
+pg_wait_profile_main(Datum main_arg)
+{
+	/* Establish signal handlers; once that's done, unblock signals. */
+	pqsignal(SIGTERM, SignalHandlerForShutdownRequest);
+	pqsignal(SIGHUP, SignalHandlerForConfigReload);
+	BackgroundWorkerUnblockSignals();
+
+	while (!ShutdownRequestPending)
+	{
+		int			rc;
+
+		rc = WaitLatch(MyLatch,
+					   WL_LATCH_SET | WL_TIMEOUT | WL_EXIT_ON_PM_DEATH,
+					   pgwp_sample_interval,
+					   PG_WAIT_EXTENSION);
+		ResetLatch(MyLatch);
+
+		if (ConfigReloadPending)
+		{
+			ConfigReloadPending = false;
+			ProcessConfigFile(PGC_SIGHUP);
+		}
+
+		if (rc & WL_TIMEOUT)
+			pgwp_sample();
+	}
+}
+
+/*
+ * SQL function returning the accumulated profile.
+ */
+Datum
+pg_wait_profile(PG_FUNCTION_ARGS)
+{
+	ReturnSetInfo *rsinfo = (ReturnSetInfo *) fcinfo->resultinfo;
+	HASH_SEQ_STATUS hash_seq;
+	pgwpEntry  *entry;
+
+	if (!pgwp || !pgwp_hash)
+		ereport(ERROR,
+				(errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
+				 errmsg("pg_wait_profile must be loaded via \"shared_preload_libraries\"")));
+
+	InitMaterializedSRF(fcinfo, 0);
+
+	LWLockAcquire(pgwp->lock, LW_SHARED);
+
+	hash_seq_init(&hash_seq, pgwp_hash);
+	while ((entry = hash_seq_search(&hash_seq)) != NULL)
+	{
+		Datum		values[3];
+		bool		nulls[3] = {0};
+		const char *event_type;
+		const char *event;
+
+		event_type = pgstat_get_wait_event_type(entry->wait_event_info);
+		event = pgstat_get_wait_event(entry->wait_event_info);
+
+		if (event_type)
+			values[0] = CStringGetTextDatum(event_type);
+		else
+			nulls[0] = true;
+		if (event)
+			values[1] = CStringGetTextDatum(event);
+		else
+			nulls[1] = true;
+		values[2] = Int64GetDatum(entry->count);
+
+		tuplestore_putvalues(rsinfo->setResult, rsinfo->setDesc,
+							 values, nulls);
+	}
+
+	LWLockRelease(pgwp->lock);
+
+	return (Datum) 0;
+}
+
+/*
+ * SQL function to discard the profile gathered so far.
+ */
+Datum
+pg_wait_profile_reset(PG_FUNCTION_ARGS)
+{
+	HASH_SEQ_STATUS hash_seq;
+	pgwpEntry  *entry;
+
+	if (!pgwp || !pgwp_hash)
+		ereport(ERROR,
+				(errcode(ERRCODE_OBJECT_NOT_IN_PREREQUISITE_STATE),
+				 errmsg("pg_wait_profile must be loaded via \"shared_preload_libraries\"")));
+
+	LWLockAcquire(pgwp->lock, LW_EXCLUSIVE);
+
+	hash_seq_init(&hash_seq, pgwp_hash);
+	while ((entry = hash_seq_search(&hash_seq)) != NULL)
+		hash_search(pgwp_hash, &entry->wait_event_info, HASH_REMOVE, NULL);
+
+	LWLockRelease(pgwp->lock);
+
+	PG_RETURN_VOID();
+}
@@ -0,0 +1,41 @@
+# Copyright (c) 2025, PostgreSQL Global Development Group
+
+use strict;
+use warnings FATAL => 'all';
+
+use PostgreSQL::Test::Cluster;
+use PostgreSQL::Test::Utils;
+use Test::More;
+
+
+my $node = PostgreSQL::Test::Cluster->new('main');
+
+$node->init;
+$node->append_conf(
+	'postgresql.conf',
+	qq{shared_preload_libraries = 'pg_wait_profile'
+    pg_wait_profile.sample_interval = 1});
+$node->start;
+
+$node->safe_psql("postgres", "CREATE EXTENSION pg_wait_profile;");
+
+# Give the sampler a moment, then make sure the view is queryable.  The
+# checkpointer and other auxiliary processes spend essentially all their time
+# waiting, so at this sample interval some samples must have accumulated.
+$node->safe_psql("postgres", "SELECT pg_sleep(1);");
+
+my $result = $node->safe_psql("postgres",
+	"SELECT count(*) > 0 FROM pg_wait_profile;");
+is($result, 't', 'profile has accumulated samples');
+
+$result = $node->safe_psql("postgres",
+	"SELECT count(*) FROM pg_wait_profile WHERE count <= 0;");
+is($result, '0', 'all counters are positive');
+
+# reset discards the profile
+$node->safe_psql("postgres", "SELECT pg_wait_profile_reset();");
+ok(1, 'reset succeeded');
+
+$node->stop;
+
+done_testing();
@@ -766,6 +766,23 @@ bringetbitmap(IndexScanDesc scan, TIDBitmap *tbm)
 		{
 			addrange = true;
 		}
+		else if (BrinTupleIsPlaceholder(btup))
+		{
+			/*
+			 * Placeholder tuples are always returned, regardless of the
+			 * values stored in them, so don't bother deforming them.
+			 */
+			addrange = true;
+		}
+		else if (scan->numberOfKeys > 0 && BrinTupleIsEmptyRange(btup))
+		{
+			/*
+			 * An empty range can't match any scan key, so skip it without
+			 * deforming.  (With no scan keys at all, every range is added,
+			 * empty or not, by the code below.)
+			 */
+			addrange = false;
+		}
 		else
 		{
 			dtup = brin_deform_tuple(bdesc, btup, dtup);
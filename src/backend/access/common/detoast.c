@@ -110,6 +110,16 @@ detoast_external_attr(struct varlena *attr)
  *
  * Note some callers assume that if the input is an EXTERNAL or COMPRESSED
  * datum, the result will be a pfree'able chunk.
+ *
+ * That ownership convention is also why there is no cache of detoasted
+ * values here, tempting as one is for queries that detoast the same datum
+ * at several call sites: callers pfree and occasionally scribble on the
+ * result, so a cache could only ever hand out copies, and this layer has
+ * no query lifetime to bound the cached memory with (toast pointers reach
+ * us from arbitrary contexts, including ones with no executor above).
+ * Avoiding the redundant work is the executor's job: project the detoasted
+ * value once (e.g. in a subquery or LATERAL alias) and reference that, or
+ * keep it in an expanded datum across accesses.
  * ----------
  */
 struct varlena *
@@ -485,6 +495,8 @@ toast_decompress_datum(struct varlena *attr)
 			return pglz_decompress_datum(attr);
 		case TOAST_LZ4_COMPRESSION_ID:
 			return lz4_decompress_datum(attr);
+		case TOAST_ZSTD_COMPRESSION_ID:
+			return zstd_decompress_datum(attr);
 		default:
 			elog(ERROR, "invalid compression method id %d", cmid);
 			return NULL;		/* keep compiler quiet */
@@ -528,6 +540,8 @@ toast_decompress_datum_slice(struct varlena *attr, int32 slicelength)
 			return pglz_decompress_datum_slice(attr, slicelength);
 		case TOAST_LZ4_COMPRESSION_ID:
 			return lz4_decompress_datum_slice(attr, slicelength);
+		case TOAST_ZSTD_COMPRESSION_ID:
+			return zstd_decompress_datum_slice(attr, slicelength);
 		default:
 			elog(ERROR, "invalid compression method id %d", cmid);
 			return NULL;		/* keep compiler quiet */
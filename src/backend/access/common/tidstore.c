@@ -128,6 +128,17 @@ struct TidStore
 
 	/* DSA area for TidStore if using shared memory */
 	dsa_area   *area;
+
+	/*
+	 * Cache of the entry for the block most recently probed by
+	 * TidStoreIsMember().  Heap TIDs arriving from an index are often
+	 * correlated, so runs of lookups for the same block are common; the
+	 * cache lets them skip the radix tree descent.  Invalidated whenever
+	 * this backend modifies the store; per the usual rules, other backends
+	 * must not modify a shared store concurrently with lookups anyway.
+	 */
+	BlockNumber lastblk;
+	BlocktableEntry *lastpage;	/* lookup result; NULL if no entry */
 };
 #define TidStoreIsShared(ts) ((ts)->area != NULL)
 
@@ -167,6 +178,7 @@ TidStoreCreateLocal(size_t max_bytes, bool insert_only)
 	size_t		maxBlockSize = ALLOCSET_DEFAULT_MAXSIZE;
 
 	ts = palloc0(sizeof(TidStore));
+	ts->lastblk = InvalidBlockNumber;
 
 	/* choose the maxBlockSize to be no larger than 1/16 of max_bytes */
 	while (16 * maxBlockSize > max_bytes)
@@ -213,6 +225,7 @@ TidStoreCreateShared(size_t max_bytes, int tranche_id)
 	size_t		dsa_max_size = DSA_MAX_SEGMENT_SIZE;
 
 	ts = palloc0(sizeof(TidStore));
+	ts->lastblk = InvalidBlockNumber;
 
 	/*
 	 * Choose the initial and maximum DSA segment sizes to be no longer than
@@ -251,6 +264,7 @@ TidStoreAttach(dsa_handle area_handle, dsa_pointer handle)
 
 	/* create per-backend state */
 	ts = palloc0(sizeof(TidStore));
+	ts->lastblk = InvalidBlockNumber;
 
 	area = dsa_attach(area_handle);
 
@@ -414,6 +428,9 @@ TidStoreSetBlockOffsets(TidStore *ts, BlockNumber blkno, OffsetNumber *offsets,
 		shared_ts_set(ts->tree.shared, blkno, page);
 	else
 		local_ts_set(ts->tree.local, blkno, page);
+
+	/* the insertion may have moved entries, so forget the lookup cache */
+	ts->lastblk = InvalidBlockNumber;
 }
 
 /* Return true if the given TID is present in the TidStore */
@@ -426,10 +443,18 @@ TidStoreIsMember(TidStore *ts, const ItemPointerData *tid)
 	BlockNumber blk = ItemPointerGetBlockNumber(tid);
 	OffsetNumber off = ItemPointerGetOffsetNumber(tid);
 
-	if (TidStoreIsShared(ts))
-		page = shared_ts_find(ts->tree.shared, blk);
+	if (blk == ts->lastblk)
+		page = ts->lastpage;
 	else
-		page = local_ts_find(ts->tree.local, blk);
+	{
+		if (TidStoreIsShared(ts))
+			page = shared_ts_find(ts->tree.shared, blk);
+		else
+			page = local_ts_find(ts->tree.local, blk);
+
+		ts->lastblk = blk;
+		ts->lastpage = page;
+	}
 
 	/* no entry for the blk */
 	if (page == NULL)
@@ -464,11 +464,22 @@ ginHeapTupleFastInsert(GinState *ginstate, GinTupleCollector *collector)
 	END_CRIT_SECTION();
 
 	/*
-	 * Since it could contend with concurrent cleanup process we cleanup
-	 * pending list not forcibly.
+	 * Hand the cleanup off to an autovacuum work item when we can, so the
+	 * inserting backend doesn't absorb the latency of folding the pending
+	 * list into the main tree; this mirrors what BRIN does for range
+	 * summarization.  If autovacuum is disabled or the work item can't be
+	 * recorded, fall back to doing the cleanup ourselves, not forcibly
+	 * since it could contend with a concurrent cleanup process.
 	 */
 	if (needCleanup)
-		ginInsertCleanup(ginstate, false, true, false, NULL);
+	{
+		if (RelationUsesLocalBuffers(index) ||
+			!AutoVacuumingActive() ||
+			!AutoVacuumRequestWork(AVW_GinCleanPendingList,
+								   RelationGetRelid(index),
+								   InvalidBlockNumber))
+			ginInsertCleanup(ginstate, false, true, false, NULL);
+	}
 }
 
 /*
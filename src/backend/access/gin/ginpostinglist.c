@@ -303,11 +303,20 @@ ginPostingListDecodeAllSegments(GinPostingList *segment, int len, int *ndecoded_
 	int			ndecoded;
 	unsigned char *ptr;
 	unsigned char *endptr;
+	GinPostingList *walk;
 
 	/*
-	 * Guess an initial size of the array.
+	 * Compute an upper bound on the number of items: every encoded delta
+	 * uses at least one byte, and each segment additionally stores its
+	 * first item uncompressed.  Sizing the array to the bound up front
+	 * means the enlargement checks below never fire; sizing it from the
+	 * first segment alone, as we used to, meant a cascade of repallocs
+	 * whenever a multi-segment page was decoded.
 	 */
-	nallocated = segment->nbytes * 2 + 1;
+	nallocated = 0;
+	for (walk = segment; (char *) walk < endseg;
+		 walk = GinNextPostingListSegment(walk))
+		nallocated += walk->nbytes + 1;
 	result = palloc(nallocated * sizeof(ItemPointerData));
 
 	ndecoded = 0;
@@ -3,6 +3,18 @@
  * gistbuildbuffers.c
  *	  node buffer management functions for GiST buffering build algorithm.
  *
+ * A note on the temp file I/O pattern: spilled buffer pages are read and
+ * written one block at a time, and the blocks of one node buffer are
+ * scattered across the file, because freed blocks are reused LIFO and a
+ * buffer's pages are found by following each page's link to its
+ * predecessor.  That makes draining a large buffer a chain of dependent
+ * random reads that readahead (or asynchronous batching) cannot get ahead
+ * of — the next block number is only known once the current block is in
+ * memory.  Keeping per-buffer block lists in memory to enable vectored
+ * I/O would cost about as much memory as just keeping more buffer pages
+ * resident, which is the better spend.  If a buffered build is I/O bound
+ * here, raising maintenance_work_mem (or building with buffering=off when
+ * the data fits) attacks the spill itself rather than its pattern.
  *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
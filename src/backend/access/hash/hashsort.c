@@ -25,13 +25,115 @@
 
 #include "postgres.h"
 
+#include "access/genam.h"
 #include "access/hash.h"
+#include "access/parallel.h"
+#include "access/table.h"
+#include "access/tableam.h"
+#include "catalog/index.h"
 #include "commands/progress.h"
 #include "miscadmin.h"
 #include "pgstat.h"
 #include "port/pg_bitutils.h"
+#include "tcop/tcopprot.h"
+#include "utils/rel.h"
 #include "utils/tuplesort.h"
 
+/* Magic numbers for parallel build, in the TOC of the DSM segment */
+#define PARALLEL_KEY_HASH_SHARED		UINT64CONST(0xD000000000000001)
+#define PARALLEL_KEY_TUPLESORT			UINT64CONST(0xD000000000000002)
+#define PARALLEL_KEY_QUERY_TEXT			UINT64CONST(0xD000000000000003)
+#define PARALLEL_KEY_WAL_USAGE			UINT64CONST(0xD000000000000004)
+#define PARALLEL_KEY_BUFFER_USAGE		UINT64CONST(0xD000000000000005)
+
+/*
+ * Status for parallel builds.  This is allocated in a dynamic shared memory
+ * segment.  Note that there is a separate tuplesort TOC entry, private to
+ * tuplesort.c but allocated by this module on its behalf.
+ */
+typedef struct HashShared
+{
+	/*
+	 * These fields are not modified during the build.  They primarily exist
+	 * for the benefit of worker processes that need to create a spool
+	 * corresponding to that used by the leader.  The masks mirror the
+	 * leader's HSpool, so that every participant sorts with the same bucket
+	 * assignment.
+	 */
+	Oid			heaprelid;
+	Oid			indexrelid;
+	bool		isconcurrent;
+	int			scantuplesortstates;
+	uint32		high_mask;
+	uint32		low_mask;
+	uint32		max_buckets;
+
+	/* Query ID, for report in worker processes */
+	int64		queryid;
+
+	/*
+	 * workersdonecv is used to monitor the progress of workers.  All parallel
+	 * participants must indicate that they are done before the leader can
+	 * use mutable state that workers maintain during the scan (and before
+	 * the leader can proceed to tuplesort_performsort()).
+	 */
+	ConditionVariable workersdonecv;
+
+	/* mutex protects all following fields */
+	slock_t		mutex;
+
+	/*
+	 * Mutable state that is maintained by workers, and reported back to the
+	 * leader at end of the parallel scan.
+	 */
+	int			nparticipantsdone;
+	double		reltuples;
+	double		indtuples;
+	bool		brokenhotchain;
+
+	/*
+	 * ParallelTableScanDescData data follows. Can't directly embed here, as
+	 * implementations of the parallel table scan desc interface might need
+	 * stronger alignment.
+	 */
+} HashShared;
+
+/*
+ * Return pointer to a HashShared's parallel table scan.
+ *
+ * c.f. shm_toc_allocate as to why BUFFERALIGN is used, rather than just
+ * MAXALIGN.
+ */
+#define ParallelTableScanFromHashShared(shared) \
+	(ParallelTableScanDesc) ((char *) (shared) + BUFFERALIGN(sizeof(HashShared)))
+
+/*
+ * Status for leader in parallel build.
+ */
+typedef struct HashLeader
+{
+	/* parallel context itself */
+	ParallelContext *pcxt;
+
+	/*
+	 * nparticipanttuplesorts is the exact number of worker processes
+	 * successfully launched, plus one leader process if it participates as a
+	 * worker (only DISABLE_LEADER_PARTICIPATION builds avoid leader
+	 * participating as a worker).
+	 */
+	int			nparticipanttuplesorts;
+
+	/*
+	 * Leader process convenience pointers to shared state (leader avoids TOC
+	 * lookups).
+	 */
+	HashShared *hashshared;
+	Sharedsort *sharedsort;
+	Snapshot	snapshot;
+	WalUsage   *walusage;
+	BufferUsage *bufferusage;
+} HashLeader;
+
 
 /*
  * Status record for spooling/sorting phase.
@@ -50,16 +152,34 @@ struct HSpool
 	uint32		high_mask;
 	uint32		low_mask;
 	uint32		max_buckets;
+
+	/*
+	 * hleader is only present when a parallel build was launched, and only
+	 * in the leader process.
+	 */
+	HashLeader *hleader;
 };
 
+static void _h_begin_parallel(HSpool *hspool, Relation heap,
+							  bool isconcurrent, int request);
+static void _h_end_parallel(HashLeader *hleader);
+static Size _h_parallel_estimate_shared(Relation heap, Snapshot snapshot);
+static void _h_leader_participate_as_worker(HSpool *hspool, Relation heap);
+static void _h_parallel_scan_and_sort(Relation heap, Relation index,
+									  HashShared *hashshared,
+									  Sharedsort *sharedsort,
+									  int sortmem, bool progress);
+
 
 /*
  * create and initialize a spool structure
  */
 HSpool *
-_h_spoolinit(Relation heap, Relation index, uint32 num_buckets)
+_h_spoolinit(Relation heap, Relation index, uint32 num_buckets,
+			 IndexInfo *indexInfo)
 {
 	HSpool	   *hspool = (HSpool *) palloc0(sizeof(HSpool));
+	SortCoordinate coordinate = NULL;
 
 	hspool->index = index;
 
@@ -75,6 +195,22 @@ _h_spoolinit(Relation heap, Relation index, uint32 num_buckets)
 	hspool->low_mask = (hspool->high_mask >> 1);
 	hspool->max_buckets = num_buckets - 1;
 
+	/*
+	 * Attempt to launch parallel worker scan when required.  If we can't,
+	 * the scan and sort run serially, as before.
+	 */
+	if (indexInfo->ii_ParallelWorkers > 0)
+		_h_begin_parallel(hspool, heap, indexInfo->ii_Concurrent,
+						  indexInfo->ii_ParallelWorkers);
+
+	if (hspool->hleader)
+	{
+		coordinate = (SortCoordinate) palloc0(sizeof(SortCoordinateData));
+		coordinate->isWorker = false;
+		coordinate->nParticipants = hspool->hleader->nparticipanttuplesorts;
+		coordinate->sharedsort = hspool->hleader->sharedsort;
+	}
+
 	/*
 	 * We size the sort area as maintenance_work_mem rather than work_mem to
 	 * speed index creation.  This should be OK since a single backend can't
@@ -86,7 +222,7 @@ _h_spoolinit(Relation heap, Relation index, uint32 num_buckets)
 												   hspool->low_mask,
 												   hspool->max_buckets,
 												   maintenance_work_mem,
-												   NULL,
+												   coordinate,
 												   TUPLESORT_NONE);
 
 	return hspool;
@@ -99,6 +235,8 @@ void
 _h_spooldestroy(HSpool *hspool)
 {
 	tuplesort_end(hspool->sortstate);
+	if (hspool->hleader)
+		_h_end_parallel(hspool->hleader);
 	pfree(hspool);
 }
 
@@ -155,3 +293,468 @@ _h_indexbuild(HSpool *hspool, Relation heapRel)
 									 ++tups_done);
 	}
 }
+
+
+/*
+ * Within leader, wait for end of the parallel heap scan, if any.
+ *
+ * Returns false if the spool was not set up for a parallel build, in which
+ * case the caller must scan the heap itself.  Otherwise waits until all
+ * participants have fed the shared sort, fills in the fields needed for
+ * ambuild statistics, and returns true.
+ */
+bool
+_h_parallel_heapscan(HSpool *hspool, IndexInfo *indexInfo,
+					 double *reltuples, double *indtuples)
+{
+	HashShared *hashshared;
+	int			nparticipanttuplesorts;
+
+	if (hspool->hleader == NULL)
+		return false;
+
+	hashshared = hspool->hleader->hashshared;
+	nparticipanttuplesorts = hspool->hleader->nparticipanttuplesorts;
+	for (;;)
+	{
+		SpinLockAcquire(&hashshared->mutex);
+		if (hashshared->nparticipantsdone == nparticipanttuplesorts)
+		{
+			*reltuples = hashshared->reltuples;
+			*indtuples = hashshared->indtuples;
+			indexInfo->ii_BrokenHotChain = hashshared->brokenhotchain;
+			SpinLockRelease(&hashshared->mutex);
+			break;
+		}
+		SpinLockRelease(&hashshared->mutex);
+
+		ConditionVariableSleep(&hashshared->workersdonecv,
+							   WAIT_EVENT_PARALLEL_CREATE_INDEX_SCAN);
+	}
+
+	ConditionVariableCancelSleep();
+
+	return true;
+}
+
+/*
+ * Create parallel context, and launch workers for leader.
+ *
+ * If not even a single worker process can be launched, hspool->hleader is
+ * never set, and the caller should proceed with a serial scan and sort.
+ */
+static void
+_h_begin_parallel(HSpool *hspool, Relation heap, bool isconcurrent,
+				  int request)
+{
+	ParallelContext *pcxt;
+	int			scantuplesortstates;
+	Snapshot	snapshot;
+	Size		esthashshared;
+	Size		estsort;
+	HashShared *hashshared;
+	Sharedsort *sharedsort;
+	HashLeader *hleader = (HashLeader *) palloc0(sizeof(HashLeader));
+	WalUsage   *walusage;
+	BufferUsage *bufferusage;
+	bool		leaderparticipates = true;
+	int			querylen;
+
+#ifdef DISABLE_LEADER_PARTICIPATION
+	leaderparticipates = false;
+#endif
+
+	/*
+	 * Enter parallel mode, and create context for parallel build of hash
+	 * index
+	 */
+	EnterParallelMode();
+	Assert(request > 0);
+	pcxt = CreateParallelContext("postgres", "_hash_parallel_build_main",
+								 request);
+
+	scantuplesortstates = leaderparticipates ? request + 1 : request;
+
+	/*
+	 * Prepare for scan of the base relation.  In a normal index build, we
+	 * use SnapshotAny because we must retrieve all tuples and do our own
+	 * time qual checks (because we have to index RECENTLY_DEAD tuples).  In
+	 * a concurrent build, we take a regular MVCC snapshot and index
+	 * whatever's live according to that.
+	 */
+	if (!isconcurrent)
+		snapshot = SnapshotAny;
+	else
+		snapshot = RegisterSnapshot(GetTransactionSnapshot());
+
+	/*
+	 * Estimate size for our own PARALLEL_KEY_HASH_SHARED workspace, and
+	 * PARALLEL_KEY_TUPLESORT tuplesort workspace
+	 */
+	esthashshared = _h_parallel_estimate_shared(heap, snapshot);
+	shm_toc_estimate_chunk(&pcxt->estimator, esthashshared);
+	estsort = tuplesort_estimate_shared(scantuplesortstates);
+	shm_toc_estimate_chunk(&pcxt->estimator, estsort);
+	shm_toc_estimate_keys(&pcxt->estimator, 2);
+
+	/*
+	 * Estimate space for WalUsage and BufferUsage -- PARALLEL_KEY_WAL_USAGE
+	 * and PARALLEL_KEY_BUFFER_USAGE.
+	 */
+	shm_toc_estimate_chunk(&pcxt->estimator,
+						   mul_size(sizeof(WalUsage), pcxt->nworkers));
+	shm_toc_estimate_keys(&pcxt->estimator, 1);
+	shm_toc_estimate_chunk(&pcxt->estimator,
+						   mul_size(sizeof(BufferUsage), pcxt->nworkers));
+	shm_toc_estimate_keys(&pcxt->estimator, 1);
+
+	/* Finally, estimate PARALLEL_KEY_QUERY_TEXT space */
+	if (debug_query_string)
+	{
+		querylen = strlen(debug_query_string);
+		shm_toc_estimate_chunk(&pcxt->estimator, querylen + 1);
+		shm_toc_estimate_keys(&pcxt->estimator, 1);
+	}
+	else
+		querylen = 0;			/* keep compiler quiet */
+
+	/* Everyone's had a chance to ask for space, so now create the DSM */
+	InitializeParallelDSM(pcxt);
+
+	/* If no DSM segment was available, back out (do serial build) */
+	if (pcxt->seg == NULL)
+	{
+		if (IsMVCCSnapshot(snapshot))
+			UnregisterSnapshot(snapshot);
+		DestroyParallelContext(pcxt);
+		ExitParallelMode();
+		return;
+	}
+
+	/* Store shared build state, for which we reserved space */
+	hashshared = (HashShared *) shm_toc_allocate(pcxt->toc, esthashshared);
+	/* Initialize immutable state */
+	hashshared->heaprelid = RelationGetRelid(heap);
+	hashshared->indexrelid = RelationGetRelid(hspool->index);
+	hashshared->isconcurrent = isconcurrent;
+	hashshared->scantuplesortstates = scantuplesortstates;
+	hashshared->high_mask = hspool->high_mask;
+	hashshared->low_mask = hspool->low_mask;
+	hashshared->max_buckets = hspool->max_buckets;
+	hashshared->queryid = pgstat_get_my_query_id();
+	ConditionVariableInit(&hashshared->workersdonecv);
+	SpinLockInit(&hashshared->mutex);
+	/* Initialize mutable state */
+	hashshared->nparticipantsdone = 0;
+	hashshared->reltuples = 0.0;
+	hashshared->indtuples = 0.0;
+	hashshared->brokenhotchain = false;
+	table_parallelscan_initialize(heap,
+								  ParallelTableScanFromHashShared(hashshared),
+								  snapshot);
+
+	/*
+	 * Store shared tuplesort-private state, for which we reserved space.
+	 * Then, initialize opaque state using tuplesort routine.
+	 */
+	sharedsort = (Sharedsort *) shm_toc_allocate(pcxt->toc, estsort);
+	tuplesort_initialize_shared(sharedsort, scantuplesortstates,
+								pcxt->seg);
+
+	shm_toc_insert(pcxt->toc, PARALLEL_KEY_HASH_SHARED, hashshared);
+	shm_toc_insert(pcxt->toc, PARALLEL_KEY_TUPLESORT, sharedsort);
+
+	/* Store query string for workers */
+	if (debug_query_string)
+	{
+		char	   *sharedquery;
+
+		sharedquery = (char *) shm_toc_allocate(pcxt->toc, querylen + 1);
+		memcpy(sharedquery, debug_query_string, querylen + 1);
+		shm_toc_insert(pcxt->toc, PARALLEL_KEY_QUERY_TEXT, sharedquery);
+	}
+
+	/*
+	 * Allocate space for each worker's WalUsage and BufferUsage; no need to
+	 * initialize.
+	 */
+	walusage = shm_toc_allocate(pcxt->toc,
+								mul_size(sizeof(WalUsage), pcxt->nworkers));
+	shm_toc_insert(pcxt->toc, PARALLEL_KEY_WAL_USAGE, walusage);
+	bufferusage = shm_toc_allocate(pcxt->toc,
+								   mul_size(sizeof(BufferUsage), pcxt->nworkers));
+	shm_toc_insert(pcxt->toc, PARALLEL_KEY_BUFFER_USAGE, bufferusage);
+
+	/* Launch workers, saving status for leader/caller */
+	LaunchParallelWorkers(pcxt);
+	hleader->pcxt = pcxt;
+	hleader->nparticipanttuplesorts = pcxt->nworkers_launched;
+	if (leaderparticipates)
+		hleader->nparticipanttuplesorts++;
+	hleader->hashshared = hashshared;
+	hleader->sharedsort = sharedsort;
+	hleader->snapshot = snapshot;
+	hleader->walusage = walusage;
+	hleader->bufferusage = bufferusage;
+
+	/* If no workers were successfully launched, back out (do serial build) */
+	if (pcxt->nworkers_launched == 0)
+	{
+		_h_end_parallel(hleader);
+		return;
+	}
+
+	/* Save leader state now that it's clear build will be parallel */
+	hspool->hleader = hleader;
+
+	/* Join heap scan ourselves */
+	if (leaderparticipates)
+		_h_leader_participate_as_worker(hspool, heap);
+
+	/*
+	 * Caller needs to wait for all launched workers when we return.  Make
+	 * sure that the failure-to-start case will not hang forever.
+	 */
+	WaitForParallelWorkersToAttach(pcxt);
+}
+
+/*
+ * Shut down workers, destroy parallel context, and end parallel mode.
+ */
+static void
+_h_end_parallel(HashLeader *hleader)
+{
+	int			i;
+
+	/* Shutdown worker processes */
+	WaitForParallelWorkersToFinish(hleader->pcxt);
+
+	/*
+	 * Next, accumulate WAL usage.  (This must wait for the workers to
+	 * finish, or we might get incomplete data.)
+	 */
+	for (i = 0; i < hleader->pcxt->nworkers_launched; i++)
+		InstrAccumParallelQuery(&hleader->bufferusage[i],
+								&hleader->walusage[i]);
+
+	/* Free last reference to MVCC snapshot, if one was used */
+	if (IsMVCCSnapshot(hleader->snapshot))
+		UnregisterSnapshot(hleader->snapshot);
+	DestroyParallelContext(hleader->pcxt);
+	ExitParallelMode();
+}
+
+/*
+ * Returns size of shared memory required to store state for a parallel
+ * hash index build based on the snapshot its parallel scan will use.
+ */
+static Size
+_h_parallel_estimate_shared(Relation heap, Snapshot snapshot)
+{
+	/* c.f. shm_toc_allocate as to why BUFFERALIGN is used */
+	return add_size(BUFFERALIGN(sizeof(HashShared)),
+					table_parallelscan_estimate(heap, snapshot));
+}
+
+/*
+ * Within leader, participate as a parallel worker.
+ */
+static void
+_h_leader_participate_as_worker(HSpool *hspool, Relation heap)
+{
+	HashLeader *hleader = hspool->hleader;
+	int			sortmem;
+
+	/*
+	 * Might as well use reliable figure when doling out maintenance_work_mem
+	 * (when requested number of workers were not launched, this will be
+	 * somewhat higher than it is for other workers).
+	 */
+	sortmem = maintenance_work_mem / hleader->nparticipanttuplesorts;
+
+	/* Perform work common to all participants */
+	_h_parallel_scan_and_sort(heap, hspool->index, hleader->hashshared,
+							  hleader->sharedsort, sortmem, true);
+}
+
+/*
+ * Working state for the per-tuple callback of the parallel scan.
+ */
+typedef struct HashParallelBuildState
+{
+	Tuplesortstate *sortstate;
+	double		indtuples;
+} HashParallelBuildState;
+
+/*
+ * Per-tuple callback for table_index_build_scan, parallel case.
+ *
+ * Unlike hashbuildCallback, this always spools; a parallel build is only
+ * attempted when the sorted path was chosen.
+ */
+static void
+_hash_parallel_build_callback(Relation index,
+							  ItemPointer tid,
+							  Datum *values,
+							  bool *isnull,
+							  bool tupleIsAlive,
+							  void *state)
+{
+	HashParallelBuildState *pstate = (HashParallelBuildState *) state;
+	Datum		index_values[1];
+	bool		index_isnull[1];
+
+	/* convert data to a hash key; on failure, do not insert anything */
+	if (!_hash_convert_tuple(index,
+							 values, isnull,
+							 index_values, index_isnull))
+		return;
+
+	tuplesort_putindextuplevalues(pstate->sortstate, index, tid,
+								  index_values, index_isnull);
+
+	pstate->indtuples += 1;
+}
+
+/*
+ * Perform a worker's portion of a parallel sort.
+ *
+ * This generates a tuplesort for the passed participant, scans this
+ * participant's portion of the heap, and adds the resulting hash index
+ * tuples to the shared sort.
+ *
+ * sortmem is the amount of working memory to use within each participant,
+ * expressed in KBs.
+ */
+static void
+_h_parallel_scan_and_sort(Relation heap, Relation index,
+						  HashShared *hashshared, Sharedsort *sharedsort,
+						  int sortmem, bool progress)
+{
+	SortCoordinate coordinate;
+	HashParallelBuildState pstate;
+	TableScanDesc scan;
+	double		reltuples;
+	IndexInfo  *indexInfo;
+
+	/* Initialize local tuplesort coordination state */
+	coordinate = palloc0(sizeof(SortCoordinateData));
+	coordinate->isWorker = true;
+	coordinate->nParticipants = -1;
+	coordinate->sharedsort = sharedsort;
+
+	/* Begin "partial" tuplesort */
+	pstate.sortstate = tuplesort_begin_index_hash(heap, index,
+												  hashshared->high_mask,
+												  hashshared->low_mask,
+												  hashshared->max_buckets,
+												  sortmem, coordinate,
+												  TUPLESORT_NONE);
+	pstate.indtuples = 0;
+
+	/* Join parallel scan */
+	indexInfo = BuildIndexInfo(index);
+	indexInfo->ii_Concurrent = hashshared->isconcurrent;
+	scan = table_beginscan_parallel(heap,
+									ParallelTableScanFromHashShared(hashshared));
+	reltuples = table_index_build_scan(heap, index, indexInfo,
+									   true, progress,
+									   _hash_parallel_build_callback,
+									   &pstate, scan);
+
+	/* Execute this participant's part of the sort */
+	tuplesort_performsort(pstate.sortstate);
+
+	/*
+	 * Done.  Record ambuild statistics, and whether we encountered a broken
+	 * HOT chain.
+	 */
+	SpinLockAcquire(&hashshared->mutex);
+	hashshared->nparticipantsdone++;
+	hashshared->reltuples += reltuples;
+	hashshared->indtuples += pstate.indtuples;
+	if (indexInfo->ii_BrokenHotChain)
+		hashshared->brokenhotchain = true;
+	SpinLockRelease(&hashshared->mutex);
+
+	/* Notify leader */
+	ConditionVariableSignal(&hashshared->workersdonecv);
+
+	/* We can end the tuplesort immediately */
+	tuplesort_end(pstate.sortstate);
+}
+
+/*
+ * Perform work within a launched parallel process.
+ */
+void
+_hash_parallel_build_main(dsm_segment *seg, shm_toc *toc)
+{
+	char	   *sharedquery;
+	HashShared *hashshared;
+	Sharedsort *sharedsort;
+	Relation	heapRel;
+	Relation	indexRel;
+	LOCKMODE	heapLockmode;
+	LOCKMODE	indexLockmode;
+	WalUsage   *walusage;
+	BufferUsage *bufferusage;
+	int			sortmem;
+
+	/*
+	 * The only possible status flag that can be set to the parallel worker
+	 * is PROC_IN_SAFE_IC.
+	 */
+	Assert((MyProc->statusFlags == 0) ||
+		   (MyProc->statusFlags == PROC_IN_SAFE_IC));
+
+	/* Set debug_query_string for individual workers first */
+	sharedquery = shm_toc_lookup(toc, PARALLEL_KEY_QUERY_TEXT, true);
+	debug_query_string = sharedquery;
+
+	/* Report the query string from leader */
+	pgstat_report_activity(STATE_RUNNING, debug_query_string);
+
+	/* Look up hash shared state */
+	hashshared = shm_toc_lookup(toc, PARALLEL_KEY_HASH_SHARED, false);
+
+	/* Open relations using lock modes known to be obtained by index.c */
+	if (!hashshared->isconcurrent)
+	{
+		heapLockmode = ShareLock;
+		indexLockmode = AccessExclusiveLock;
+	}
+	else
+	{
+		heapLockmode = ShareUpdateExclusiveLock;
+		indexLockmode = RowExclusiveLock;
+	}
+
+	/* Track query ID */
+	pgstat_report_query_id(hashshared->queryid, false);
+
+	/* Open relations within worker */
+	heapRel = table_open(hashshared->heaprelid, heapLockmode);
+	indexRel = index_open(hashshared->indexrelid, indexLockmode);
+
+	/* Look up shared state private to tuplesort.c */
+	sharedsort = shm_toc_lookup(toc, PARALLEL_KEY_TUPLESORT, false);
+	tuplesort_attach_shared(sharedsort, seg);
+
+	/* Prepare to track buffer usage during parallel execution */
+	InstrStartParallelQuery();
+
+	/* Perform sorting of our portion of the shared spool */
+	sortmem = maintenance_work_mem / hashshared->scantuplesortstates;
+	_h_parallel_scan_and_sort(heapRel, indexRel, hashshared, sharedsort,
+							  sortmem, false);
+
+	/* Report WAL/buffer usage during parallel execution */
+	bufferusage = shm_toc_lookup(toc, PARALLEL_KEY_BUFFER_USAGE, false);
+	walusage = shm_toc_lookup(toc, PARALLEL_KEY_WAL_USAGE, false);
+	InstrEndParallelQuery(&bufferusage[ParallelWorkerNumber],
+						  &walusage[ParallelWorkerNumber]);
+
+	index_close(indexRel, indexLockmode);
+	table_close(heapRel, heapLockmode);
+}
@@ -313,6 +313,20 @@ _hash_get_indextuple_hashkey(IndexTuple itup)
  * Note: callers know that the index-column arrays are always of length 1.
  * In principle, there could be more than one input column, though we do not
  * currently support that.
+ *
+ * Widening this to 64-bit hash codes (the opclasses do provide
+ * HASHEXTENDED_PROC) is not just a matter of calling the other support
+ * function: the uint32 hash key computed here is what gets stored as the
+ * index tuple's only attribute, and the bucket addressing in the metapage
+ * (highmask/lowmask/spares) is built around 32-bit codes, so a wider code
+ * means a new HASH_VERSION on-disk format and a REINDEX of every hash
+ * index.  Multi-column keys could in principle be supported here by
+ * combining the per-column hashes into the one stored code, but the AM
+ * would then be unable to distinguish scans supplying only a prefix of the
+ * columns, and nulls in later columns would need a representation; nobody
+ * has worked out semantics worth the catalog churn.  Note also that bucket
+ * pages keep their entries sorted by hash code for _hash_binsearch, which
+ * is what an open-addressing page layout would have to beat.
  */
 bool
 _hash_convert_tuple(Relation index,
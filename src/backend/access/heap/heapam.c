@@ -668,6 +668,15 @@ heap_fetch_next_buffer(HeapScanDesc scan, ScanDirection dir)
 	{
 		scan->rs_prefetch_block = scan->rs_cblock;
 		read_stream_reset(scan->rs_read_stream);
+
+		/*
+		 * The stream was created with READ_STREAM_SEQUENTIAL on the
+		 * assumption of an ascending block order.  Backward scans read in
+		 * descending order, where kernel read-ahead doesn't help, so
+		 * withdraw that promise to get explicit read-ahead advice instead.
+		 */
+		read_stream_set_sequential(scan->rs_read_stream,
+								   ScanDirectionIsForward(dir));
 	}
 
 	scan->rs_dir = dir;
@@ -1720,6 +1729,14 @@ heap_fetch(Relation relation,
  *
  * Unlike heap_fetch, the caller must already have pin and (at least) share
  * lock on the buffer; it is still pinned/locked at exit.
+ *
+ * Note that the walk already starts as far down the chain as the page can
+ * take us: pruning keeps the root's redirect line pointer aimed at the
+ * earliest chain member that could still be visible to anyone.  A hint
+ * pointing closer to "the" visible tuple isn't possible, because which
+ * member is visible depends on the caller's snapshot; chains only stay
+ * long while several versions are live simultaneously, or until pruning
+ * gets a chance to run.
  */
 bool
 heap_hot_search_buffer(ItemPointer tid, Relation relation, Buffer buffer,
@@ -2421,6 +2438,15 @@ heap_multi_insert(Relation relation, TupleTableSlot **slots, int ntuples,
 	 */
 	CheckForSerializableConflictIn(relation, NULL, InvalidBlockNumber);
 
+	/*
+	 * Each tuple contributes two rdata chunks to its page's WAL record (the
+	 * xl_multi_insert_tuple header and the tuple data, registered in place).
+	 * Make sure there's room for a full page's worth before entering the
+	 * critical section.
+	 */
+	if (needwal)
+		XLogEnsureRecordSpace(0, MaxHeapTuplesPerPage * 2 + XLR_NORMAL_RDATAS);
+
 	ndone = 0;
 	while (ndone < ntuples)
 	{
@@ -2543,8 +2569,6 @@ heap_multi_insert(Relation relation, TupleTableSlot **slots, int ntuples,
 			XLogRecPtr	recptr;
 			xl_heap_multi_insert *xlrec;
 			uint8		info = XLOG_HEAP2_MULTI_INSERT;
-			char	   *tupledata;
-			int			totaldatalen;
 			char	   *scratchptr = scratch.data;
 			bool		init;
 			int			bufflags = 0;
@@ -2568,9 +2592,6 @@ heap_multi_insert(Relation relation, TupleTableSlot **slots, int ntuples,
 			if (!init)
 				scratchptr += nthispage * sizeof(OffsetNumber);
 
-			/* the rest of the scratch space is used for tuple data */
-			tupledata = scratchptr;
-
 			/* check that the mutually exclusive flags are not both set */
 			Assert(!(all_visible_cleared && all_frozen_set));
 
@@ -2588,37 +2609,6 @@ heap_multi_insert(Relation relation, TupleTableSlot **slots, int ntuples,
 
 			xlrec->ntuples = nthispage;
 
-			/*
-			 * Write out an xl_multi_insert_tuple and the tuple data itself
-			 * for each tuple.
-			 */
-			for (i = 0; i < nthispage; i++)
-			{
-				HeapTuple	heaptup = heaptuples[ndone + i];
-				xl_multi_insert_tuple *tuphdr;
-				int			datalen;
-
-				if (!init)
-					xlrec->offsets[i] = ItemPointerGetOffsetNumber(&heaptup->t_self);
-				/* xl_multi_insert_tuple needs two-byte alignment. */
-				tuphdr = (xl_multi_insert_tuple *) SHORTALIGN(scratchptr);
-				scratchptr = ((char *) tuphdr) + SizeOfMultiInsertTuple;
-
-				tuphdr->t_infomask2 = heaptup->t_data->t_infomask2;
-				tuphdr->t_infomask = heaptup->t_data->t_infomask;
-				tuphdr->t_hoff = heaptup->t_data->t_hoff;
-
-				/* write bitmap [+ padding] [+ oid] + data */
-				datalen = heaptup->t_len - SizeofHeapTupleHeader;
-				memcpy(scratchptr,
-					   (char *) heaptup->t_data + SizeofHeapTupleHeader,
-					   datalen);
-				tuphdr->datalen = datalen;
-				scratchptr += datalen;
-			}
-			totaldatalen = scratchptr - tupledata;
-			Assert((scratchptr - scratch.data) < BLCKSZ);
-
 			if (need_tuple_data)
 				xlrec->flags |= XLH_INSERT_CONTAINS_NEW_TUPLE;
 
@@ -2644,12 +2634,56 @@ heap_multi_insert(Relation relation, TupleTableSlot **slots, int ntuples,
 				bufflags |= REGBUF_KEEP_DATA;
 
 			XLogBeginInsert();
-			XLogRegisterData(xlrec, tupledata - scratch.data);
+			XLogRegisterData(xlrec, scratchptr - scratch.data);
 			XLogRegisterBuffer(0, buffer, REGBUF_STANDARD | bufflags);
 			if (all_frozen_set)
 				XLogRegisterBuffer(1, vmbuffer, 0);
 
-			XLogRegisterBufData(0, tupledata, totaldatalen);
+			/*
+			 * Register an xl_multi_insert_tuple header for each tuple, with
+			 * the tuple data registered in place rather than copied through
+			 * the scratch area.  The chunks concatenate to the same byte
+			 * stream as a single contiguous registration, including the
+			 * alignment padding in front of each header, so the redo side
+			 * sees no difference.
+			 */
+			for (i = 0; i < nthispage; i++)
+			{
+				HeapTuple	heaptup = heaptuples[ndone + i];
+				xl_multi_insert_tuple *tuphdr;
+				int			datalen;
+
+				if (!init)
+					xlrec->offsets[i] = ItemPointerGetOffsetNumber(&heaptup->t_self);
+				/* xl_multi_insert_tuple needs two-byte alignment. */
+				tuphdr = (xl_multi_insert_tuple *) SHORTALIGN(scratchptr);
+
+				tuphdr->t_infomask2 = heaptup->t_data->t_infomask2;
+				tuphdr->t_infomask = heaptup->t_data->t_infomask;
+				tuphdr->t_hoff = heaptup->t_data->t_hoff;
+
+				/* bitmap [+ padding] [+ oid] + data follow the header */
+				datalen = heaptup->t_len - SizeofHeapTupleHeader;
+				tuphdr->datalen = datalen;
+
+				XLogRegisterBufData(0, scratchptr,
+									((char *) tuphdr + SizeOfMultiInsertTuple) - scratchptr);
+				XLogRegisterBufData(0,
+									(char *) heaptup->t_data + SizeofHeapTupleHeader,
+									datalen);
+
+				/*
+				 * Advance the cursor past the tuple data as well, even
+				 * though the data was registered in place and never copied
+				 * into the scratch area: the cursor must track the
+				 * position in the concatenated stream, or the SHORTALIGN
+				 * for the next header would disagree with where redo,
+				 * which aligns cumulative stream positions, expects the
+				 * padding to be.
+				 */
+				scratchptr = ((char *) tuphdr) + SizeOfMultiInsertTuple + datalen;
+			}
+			Assert((scratchptr - scratch.data) < BLCKSZ);
 
 			/* filtering by origin on a row level is much more efficient */
 			XLogSetRecordFlags(XLOG_INCLUDE_ORIGIN);
@@ -7060,6 +7094,19 @@ FreezeMultiXactId(MultiXactId multi, uint16 t_infomask,
  * It will be set as tuple's new xmax when our *frz output is processed within
  * heap_execute_freeze_tuple later on.  If the tuple is in a shared buffer
  * then caller had better have an exclusive lock on it already.
+ *
+ * A note on the oft-proposed alternative of widening XIDs to 64 bits (with
+ * a per-page epoch base in the special space) to make freezing unnecessary:
+ * that removes the wraparound deadline, but not freezing itself.  Freezing
+ * is also what allows pg_xact and pg_multixact to be truncated — with
+ * never-frozen 64-bit XIDs, commit status for arbitrarily old transactions
+ * must remain resolvable forever.  The page conversion is not free either:
+ * completely full pages have no room for a widened special area, and every
+ * XID consumer outside the heap (multixacts, btree split XIDs, 2PC, the
+ * replication protocol) needs its own answer.  Within the current format,
+ * the way to tame freeze I/O storms is to spread the work out: lower
+ * vacuum_freeze_min_age / autovacuum_freeze_max_age so each VACUUM freezes
+ * a little, instead of letting an aggressive one rewrite everything.
  */
 bool
 heap_prepare_freeze_tuple(HeapTupleHeader tuple,
@@ -296,8 +296,21 @@ RelationAddBlocks(Relation relation, BulkInsertState bistate,
 		 * ---
 		 */
 		if (bistate)
+		{
 			extend_by_pages = Max(extend_by_pages, bistate->already_extended_by);
 
+			/*
+			 * Similarly, if this backend bulk-extended the relation before
+			 * (e.g. in a previous COPY), resume at the size that extension
+			 * ramped up to rather than starting over.  The hint lives in the
+			 * SMgrRelation so that it survives across bulk operations; we
+			 * consult it only for bulk inserts so that trickle inserts don't
+			 * over-extend just because a bulk load happened earlier.
+			 */
+			extend_by_pages = Max(extend_by_pages,
+								  RelationGetSmgr(relation)->smgr_extend_hint);
+		}
+
 		/*
 		 * Can't extend by more than MAX_BUFFERS_TO_EXTEND_BY, we need to pin
 		 * them all concurrently.
@@ -425,6 +438,14 @@ RelationAddBlocks(Relation relation, BulkInsertState bistate,
 		IncrBufferRefCount(buffer);
 		bistate->current_buf = buffer;
 		bistate->already_extended_by += extend_by_pages;
+
+		/*
+		 * Remember how large this extension was, for the benefit of later
+		 * bulk operations on the same relation.  Keeping the size stable
+		 * also avoids mdzeroextend() flip-flopping between its write and
+		 * fallocate strategies.
+		 */
+		RelationGetSmgr(relation)->smgr_extend_hint = extend_by_pages;
 	}
 
 	return buffer;
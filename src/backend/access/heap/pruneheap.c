@@ -188,6 +188,16 @@ static bool heap_page_will_freeze(Relation relation, Buffer buffer,
 /*
  * Optionally prune and repair fragmentation in the specified page.
  *
+ * XXX It has been suggested to take opportunistic pruning off the query
+ * latency path entirely by queuing prunable pages for a background process.
+ * The bgwriter can't do that work: it is not connected to a database, so it
+ * can determine neither a visibility horizon for the relation nor anything
+ * else requiring catalog access.  Deferral within the backend would only
+ * move the stall to the end of the statement.  For now we keep pruning
+ * here, but only when the page is actually short on space; pd_prune_xid
+ * already acts as the deferral mechanism between the update that leaves a
+ * dead tuple behind and the later access that finds it worth cleaning.
+ *
  * This is an opportunistic function.  It will perform housekeeping
  * only if the page heuristically looks like a candidate for pruning and we
  * can acquire buffer cleanup lock without blocking.
@@ -222,19 +232,13 @@ heap_page_prune_opt(Relation relation, Buffer buffer)
 	if (!TransactionIdIsValid(prune_xid))
 		return;
 
-	/*
-	 * Check whether prune_xid indicates that there may be dead rows that can
-	 * be cleaned up.
-	 */
-	vistest = GlobalVisTestFor(relation);
-
-	if (!GlobalVisTestIsRemovableXid(vistest, prune_xid))
-		return;
-
 	/*
 	 * We prune when a previous UPDATE failed to find enough space on the page
 	 * for a new tuple version, or when free space falls below the relation's
-	 * fill-factor target (but not less than 10%).
+	 * fill-factor target (but not less than 10%).  Apply this heuristic
+	 * before computing a visibility horizon: pages with plenty of free space
+	 * are the common case on read-mostly workloads, and this way they skip
+	 * the horizon bookkeeping entirely.
 	 *
 	 * Checking free space here is questionable since we aren't holding any
 	 * lock on the buffer; in the worst case we could get a bogus answer. It's
@@ -247,68 +251,77 @@ heap_page_prune_opt(Relation relation, Buffer buffer)
 											 HEAP_DEFAULT_FILLFACTOR);
 	minfree = Max(minfree, BLCKSZ / 10);
 
+	if (!PageIsFull(page) && PageGetHeapFreeSpace(page) >= minfree)
+		return;
+
+	/*
+	 * Check whether prune_xid indicates that there may be dead rows that can
+	 * be cleaned up.
+	 */
+	vistest = GlobalVisTestFor(relation);
+
+	if (!GlobalVisTestIsRemovableXid(vistest, prune_xid))
+		return;
+
+	/* OK, try to get exclusive buffer lock */
+	if (!ConditionalLockBufferForCleanup(buffer))
+		return;
+
+	/*
+	 * Now that we have buffer lock, get accurate information about the
+	 * page's free space, and recheck the heuristic about whether to
+	 * prune.
+	 */
 	if (PageIsFull(page) || PageGetHeapFreeSpace(page) < minfree)
 	{
-		/* OK, try to get exclusive buffer lock */
-		if (!ConditionalLockBufferForCleanup(buffer))
-			return;
+		OffsetNumber dummy_off_loc;
+		PruneFreezeResult presult;
 
 		/*
-		 * Now that we have buffer lock, get accurate information about the
-		 * page's free space, and recheck the heuristic about whether to
-		 * prune.
+		 * We don't pass the HEAP_PAGE_PRUNE_MARK_UNUSED_NOW option
+		 * regardless of whether or not the relation has indexes, since we
+		 * cannot safely determine that during on-access pruning with the
+		 * current implementation.
 		 */
-		if (PageIsFull(page) || PageGetHeapFreeSpace(page) < minfree)
-		{
-			OffsetNumber dummy_off_loc;
-			PruneFreezeResult presult;
-
-			/*
-			 * We don't pass the HEAP_PAGE_PRUNE_MARK_UNUSED_NOW option
-			 * regardless of whether or not the relation has indexes, since we
-			 * cannot safely determine that during on-access pruning with the
-			 * current implementation.
-			 */
-			PruneFreezeParams params = {
-				.relation = relation,
-				.buffer = buffer,
-				.reason = PRUNE_ON_ACCESS,
-				.options = 0,
-				.vistest = vistest,
-				.cutoffs = NULL,
-			};
-
-			heap_page_prune_and_freeze(&params, &presult, &dummy_off_loc,
-									   NULL, NULL);
-
-			/*
-			 * Report the number of tuples reclaimed to pgstats.  This is
-			 * presult.ndeleted minus the number of newly-LP_DEAD-set items.
-			 *
-			 * We derive the number of dead tuples like this to avoid totally
-			 * forgetting about items that were set to LP_DEAD, since they
-			 * still need to be cleaned up by VACUUM.  We only want to count
-			 * heap-only tuples that just became LP_UNUSED in our report,
-			 * which don't.
-			 *
-			 * VACUUM doesn't have to compensate in the same way when it
-			 * tracks ndeleted, since it will set the same LP_DEAD items to
-			 * LP_UNUSED separately.
-			 */
-			if (presult.ndeleted > presult.nnewlpdead)
-				pgstat_update_heap_dead_tuples(relation,
-											   presult.ndeleted - presult.nnewlpdead);
-		}
-
-		/* And release buffer lock */
-		LockBuffer(buffer, BUFFER_LOCK_UNLOCK);
+		PruneFreezeParams params = {
+			.relation = relation,
+			.buffer = buffer,
+			.reason = PRUNE_ON_ACCESS,
+			.options = 0,
+			.vistest = vistest,
+			.cutoffs = NULL,
+		};
+
+		heap_page_prune_and_freeze(&params, &presult, &dummy_off_loc,
+								   NULL, NULL);
 
 		/*
-		 * We avoid reuse of any free space created on the page by unrelated
-		 * UPDATEs/INSERTs by opting to not update the FSM at this point.  The
-		 * free space should be reused by UPDATEs to *this* page.
+		 * Report the number of tuples reclaimed to pgstats.  This is
+		 * presult.ndeleted minus the number of newly-LP_DEAD-set items.
+		 *
+		 * We derive the number of dead tuples like this to avoid totally
+		 * forgetting about items that were set to LP_DEAD, since they
+		 * still need to be cleaned up by VACUUM.  We only want to count
+		 * heap-only tuples that just became LP_UNUSED in our report,
+		 * which don't.
+		 *
+		 * VACUUM doesn't have to compensate in the same way when it
+		 * tracks ndeleted, since it will set the same LP_DEAD items to
+		 * LP_UNUSED separately.
 		 */
+		if (presult.ndeleted > presult.nnewlpdead)
+			pgstat_update_heap_dead_tuples(relation,
+										   presult.ndeleted - presult.nnewlpdead);
 	}
+
+	/* And release buffer lock */
+	LockBuffer(buffer, BUFFER_LOCK_UNLOCK);
+
+	/*
+	 * We avoid reuse of any free space created on the page by unrelated
+	 * UPDATEs/INSERTs by opting to not update the FSM at this point.  The
+	 * free space should be reused by UPDATEs to *this* page.
+	 */
 }
 
 /*
@@ -47,9 +47,11 @@
  * two reasons:
  *
  * When page skipping is not disabled, a normal vacuum may scan pages that are
- * marked all-visible (and even all-frozen) in the visibility map if the range
- * of skippable pages is below SKIP_PAGES_THRESHOLD. This is primarily for the
- * benefit of kernel readahead (see comment in heap_vac_scan_next_block()).
+ * marked all-visible in the visibility map if the range of skippable pages is
+ * below SKIP_PAGES_THRESHOLD and contains at least one page that is not also
+ * all-frozen. This is primarily for the benefit of kernel readahead (see
+ * comment in heap_vac_scan_next_block()). Ranges consisting only of
+ * all-frozen pages are always skipped, whatever their length.
  *
  * A normal vacuum may also scan skippable pages in an effort to freeze them
  * and decrease the backlog of all-visible but not all-frozen pages that have
@@ -192,6 +194,14 @@
 #define FAILSAFE_EVERY_PAGES \
 	((BlockNumber) (((uint64) 4 * 1024 * 1024 * 1024) / BLCKSZ))
 
+/*
+ * During aggressive VACUUMs, save a resume point in pg_class each time we get
+ * past another 1GB of pages, so that an interrupted aggressive VACUUM can
+ * later pick up roughly where it left off rather than starting over.
+ */
+#define RESUME_POINT_EVERY_PAGES \
+	((BlockNumber) (((uint64) 1024 * 1024 * 1024) / BLCKSZ))
+
 /*
  * When a table has no indexes, vacuum the FSM after every 8GB, approximately
  * (it won't be exact because we only vacuum FSM after processing a heap page
@@ -286,6 +296,11 @@ typedef struct LVRelState
 	MultiXactId NewRelminMxid;
 	bool		skippedallvis;
 
+	/* Resuming an interrupted aggressive VACUUM? */
+	BlockNumber resume_block;	/* saved scan position, or InvalidBlockNumber */
+	BlockNumber next_resume_save_block; /* save progress at this block */
+	bool		resume_saved;	/* saved a resume point during this VACUUM? */
+
 	/* Error reporting state */
 	char	   *dbname;
 	char	   *relnamespace;
@@ -813,6 +828,41 @@ heap_vacuum_rel(Relation rel, const VacuumParams params,
 
 	vacrel->skipwithvm = skipwithvm;
 
+	/*
+	 * If an earlier aggressive VACUUM of this relation was interrupted, its
+	 * pg_class entry carries the block it would have scanned next, along with
+	 * bounds on the oldest unfrozen XID/MXID it left behind on the blocks it
+	 * did get through.  Resume the scan there rather than starting over, and
+	 * seed our relfrozenxid/relminmxid tracking with the saved bounds so that
+	 * the skipped blocks are still accounted for.  The saved values can only
+	 * be trusted while relfrozenxid/relminmxid remain where the interrupted
+	 * VACUUM found them; a completed aggressive VACUUM clears them.
+	 */
+	vacrel->resume_block = InvalidBlockNumber;
+	vacrel->next_resume_save_block = RESUME_POINT_EVERY_PAGES;
+	vacrel->resume_saved = false;
+	if (vacrel->aggressive && skipwithvm &&
+		rel->rd_rel->relvacresumeblock > 0)
+	{
+		BlockNumber resumeblk = (BlockNumber) rel->rd_rel->relvacresumeblock;
+		TransactionId resumexid = rel->rd_rel->relvacresumexid;
+		MultiXactId resumemxid = rel->rd_rel->relvacresumemxid;
+
+		if (resumeblk < vacrel->rel_pages &&
+			TransactionIdIsNormal(resumexid) &&
+			!TransactionIdPrecedes(resumexid, vacrel->cutoffs.relfrozenxid) &&
+			MultiXactIdIsValid(resumemxid) &&
+			!MultiXactIdPrecedes(resumemxid, vacrel->cutoffs.relminmxid))
+		{
+			vacrel->resume_block = resumeblk;
+			vacrel->next_resume_save_block = resumeblk + RESUME_POINT_EVERY_PAGES;
+			if (TransactionIdPrecedes(resumexid, vacrel->NewRelfrozenXid))
+				vacrel->NewRelfrozenXid = resumexid;
+			if (MultiXactIdPrecedes(resumemxid, vacrel->NewRelminMxid))
+				vacrel->NewRelminMxid = resumemxid;
+		}
+	}
+
 	/*
 	 * Set up eager scan tracking state. This must happen after determining
 	 * whether or not the vacuum must be aggressive, because only normal
@@ -886,13 +936,20 @@ heap_vacuum_rel(Relation rel, const VacuumParams params,
 	 * Aggressive VACUUMs must always be able to advance relfrozenxid to a
 	 * value >= FreezeLimit, and relminmxid to a value >= MultiXactCutoff.
 	 * Non-aggressive VACUUMs may advance them by any amount, or not at all.
+	 * An aggressive VACUUM resumed from a saved scan position is bound by
+	 * the interrupted VACUUM's (older) cutoffs, so it gets the weaker
+	 * guarantee too.
 	 */
 	Assert(vacrel->NewRelfrozenXid == vacrel->cutoffs.OldestXmin ||
-		   TransactionIdPrecedesOrEquals(vacrel->aggressive ? vacrel->cutoffs.FreezeLimit :
+		   TransactionIdPrecedesOrEquals((vacrel->aggressive &&
+										  vacrel->resume_block == InvalidBlockNumber) ?
+										 vacrel->cutoffs.FreezeLimit :
 										 vacrel->cutoffs.relfrozenxid,
 										 vacrel->NewRelfrozenXid));
 	Assert(vacrel->NewRelminMxid == vacrel->cutoffs.OldestMxact ||
-		   MultiXactIdPrecedesOrEquals(vacrel->aggressive ? vacrel->cutoffs.MultiXactCutoff :
+		   MultiXactIdPrecedesOrEquals((vacrel->aggressive &&
+										vacrel->resume_block == InvalidBlockNumber) ?
+									   vacrel->cutoffs.MultiXactCutoff :
 									   vacrel->cutoffs.relminmxid,
 									   vacrel->NewRelminMxid));
 	if (vacrel->skippedallvis)
@@ -937,6 +994,20 @@ heap_vacuum_rel(Relation rel, const VacuumParams params,
 						vacrel->NewRelfrozenXid, vacrel->NewRelminMxid,
 						&frozenxid_updated, &minmulti_updated, false);
 
+	/*
+	 * This VACUUM ran to completion, so any saved aggressive-VACUUM resume
+	 * point -- whether left behind by an interrupted run or saved by this one
+	 * -- has served its purpose.  Clear it, so that the next aggressive
+	 * VACUUM starts from block zero with fresh cutoffs.  A saved point from
+	 * an interrupted aggressive run is deliberately preserved across
+	 * completed non-aggressive VACUUMs; those never introduce older XIDs, so
+	 * the saved bounds stay valid.
+	 */
+	if (vacrel->aggressive &&
+		(vacrel->resume_saved || rel->rd_rel->relvacresumeblock != 0))
+		vac_update_resume_point(rel, 0, InvalidTransactionId,
+								InvalidMultiXactId);
+
 	/*
 	 * Report results to the cumulative stats system, too.
 	 *
@@ -1208,6 +1279,18 @@ heap_vacuum_rel(Relation rel, const VacuumParams params,
  *		However, we process indexes in full every time lazy_vacuum is called,
  *		which makes index processing very inefficient when memory is in short
  *		supply.
+ *
+ *		XXX Unlike index processing, the heap passes are not parallelized,
+ *		even though the per-block work is mostly independent and dead_items
+ *		is already a DSA-backed TidStore in parallel vacuum.  Doing so needs
+ *		more than a block-range allocator: the skip logic and eager-freeze
+ *		failure caps assume a single sequential scanner, the many per-scan
+ *		counters (including NewRelfrozenXid/NewRelminMxid, which must be
+ *		merged by minimum) would need per-worker copies and aggregation, and
+ *		the one-pass (no indexes) strategy mutates pages during the scan
+ *		itself.  Workers would also each need their own read stream and
+ *		error-context state.  Until that refactoring happens, phase I and
+ *		phase III remain single-threaded.
  */
 static void
 lazy_scan_heap(LVRelState *vacrel)
@@ -1234,6 +1317,18 @@ lazy_scan_heap(LVRelState *vacrel)
 
 	/* Initialize for the first heap_vac_scan_next_block() call */
 	vacrel->current_block = InvalidBlockNumber;
+
+	/*
+	 * When resuming an interrupted aggressive VACUUM, pretend that the blocks
+	 * below the saved resume point have just been returned; the first call to
+	 * heap_vac_scan_next_block() then continues from the resume point.  Note
+	 * that we deliberately don't set skippedallvis: the saved XID/MXID bounds
+	 * already folded into NewRelfrozenXid/NewRelminMxid cover those blocks.
+	 */
+	if (vacrel->resume_block != InvalidBlockNumber)
+		vacrel->current_block = vacrel->resume_block - 1;
+
+
 	vacrel->next_unskippable_block = InvalidBlockNumber;
 	vacrel->next_unskippable_allvis = false;
 	vacrel->next_unskippable_eager_scanned = false;
@@ -1279,6 +1374,25 @@ lazy_scan_heap(LVRelState *vacrel)
 			vacrel->scanned_pages % FAILSAFE_EVERY_PAGES == 0)
 			lazy_check_wraparound_failsafe(vacrel);
 
+		/*
+		 * Periodically save a resume point in pg_class during aggressive
+		 * VACUUMs.  All blocks up to and including blkno (the last block
+		 * returned by the read stream) have been fully processed by now, and
+		 * NewRelfrozenXid/NewRelminMxid bound the oldest unfrozen XID/MXID
+		 * they could still contain, so an interrupted VACUUM can later pick
+		 * up the scan at blkno + 1.  (An aggressive VACUUM never skips pages
+		 * that are merely all-visible, so there are no unaccounted-for XIDs
+		 * behind that point.)
+		 */
+		if (vacrel->aggressive && blkno >= vacrel->next_resume_save_block)
+		{
+			vac_update_resume_point(vacrel->rel, blkno + 1,
+									vacrel->NewRelfrozenXid,
+									vacrel->NewRelminMxid);
+			vacrel->resume_saved = true;
+			vacrel->next_resume_save_block = blkno + RESUME_POINT_EVERY_PAGES;
+		}
+
 		/*
 		 * Consider if we definitely have enough space to process TIDs on page
 		 * already.  If we are close to overrunning the available space for
@@ -1622,19 +1736,28 @@ heap_vac_scan_next_block(ReadStream *stream,
 		/*
 		 * We now know the next block that we must process.  It can be the
 		 * next block after the one we just processed, or something further
-		 * ahead.  If it's further ahead, we can jump to it, but we choose to
-		 * do so only if we can skip at least SKIP_PAGES_THRESHOLD consecutive
-		 * pages.  Since we're reading sequentially, the OS should be doing
-		 * readahead for us, so there's no gain in skipping a page now and
-		 * then.  Skipping such a range might even discourage sequential
-		 * detection.
+		 * ahead.  If it's further ahead, we can jump to it.
+		 *
+		 * If the range consists only of all-frozen pages (skipsallvis is
+		 * false), jump regardless of its length: scanning all-frozen pages
+		 * accomplishes nothing, and skipping them doesn't affect our ability
+		 * to advance relfrozenxid.
+		 *
+		 * If the range contains all-visible but not all-frozen pages, we
+		 * choose to jump only if we can skip at least SKIP_PAGES_THRESHOLD
+		 * consecutive pages.  Since we're reading sequentially, the OS should
+		 * be doing readahead for us, so there's no gain in skipping a page
+		 * now and then.  Skipping such a range might even discourage
+		 * sequential detection.
 		 *
 		 * This test also enables more frequent relfrozenxid advancement
 		 * during non-aggressive VACUUMs.  If the range has any all-visible
 		 * pages then skipping makes updating relfrozenxid unsafe, which is a
 		 * real downside.
 		 */
-		if (vacrel->next_unskippable_block - next_block >= SKIP_PAGES_THRESHOLD)
+		if (vacrel->next_unskippable_block > next_block &&
+			(!skipsallvis ||
+			 vacrel->next_unskippable_block - next_block >= SKIP_PAGES_THRESHOLD))
 		{
 			next_block = vacrel->next_unskippable_block;
 			if (skipsallvis)
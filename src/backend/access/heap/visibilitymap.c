@@ -54,6 +54,19 @@
  * VACUUM will normally skip pages for which the visibility map bit is set;
  * such pages can't contain any dead tuples and therefore don't need vacuuming.
  *
+ * The page granularity is a deliberate trade-off, although it means a single
+ * recent modification makes index-only scans fetch the heap page for every
+ * TID on it.  A finer-grained map (a bit per line pointer, say) would let
+ * such scans skip fetches for the untouched tuples, but it changes the
+ * maintenance cost model fundamentally: today a bit is cleared only on a
+ * page's transition out of the all-visible state, whereas per-tuple bits
+ * would need a map update — with the same crash-safety coupling described
+ * below — on every insert, update, and delete thereafter.  It would also
+ * grow the map by two orders of magnitude, diluting the cache density that
+ * makes VM probes nearly free.  Pages recover their all-visible status the
+ * same way they lost it partially: via the next (auto)vacuum, which is the
+ * knob to turn if index-only scan hit rates sag after update passes.
+ *
  * LOCKING
  *
  * In heapam.c, whenever a page is modified so that not all tuples on the
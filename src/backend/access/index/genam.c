@@ -114,6 +114,7 @@ RelationGetIndexScan(Relation indexRelation, int nkeys, int norderbys)
 	 * transaction that was started during recovery. xactStartedInRecovery
 	 * should not be altered by index AMs.
 	 */
+	scan->xs_batch_id = 0;		/* may be maintained by index AM */
 	scan->kill_prior_tuple = false;
 	scan->xactStartedInRecovery = TransactionStartedDuringRecovery();
 	scan->ignore_killed_tuples = !scan->xactStartedInRecovery;
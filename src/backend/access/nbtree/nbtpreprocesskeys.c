@@ -132,6 +132,15 @@ static int	_bt_compare_array_elements(const void *a, const void *b, void *arg);
  * This has the potential to be much more efficient than a full index scan
  * (though it behaves like a full scan when there's many distinct "x" values).
  *
+ * XXX The same jump-to-next-prefix machinery could in principle drive a
+ * DISTINCT-on-leading-column scan in O(distinct values) page reads: a skip
+ * array with no quals on later columns already lands on the first tuple of
+ * each "x" group.  What's missing is everything above this layer: an AM
+ * entry point asking for "one tuple per distinct prefix, then advance", an
+ * index(-only) scan mode that requests it, and planner support costing such
+ * a path for SELECT DISTINCT / GROUP BY on a leading index column.  Absent
+ * those, DISTINCT still reads every entry and deduplicates above the AM.
+ *
  * Typically, redundant keys are eliminated: we keep only the tightest
  * >/>= bound and the tightest </<= bound, and if there's an = key then
  * that's the only one returned.  (So, we return either a single = key,
@@ -20,6 +20,7 @@
 #include "access/xact.h"
 #include "miscadmin.h"
 #include "pgstat.h"
+#include "storage/bufmgr.h"
 #include "storage/predicate.h"
 #include "utils/lsyscache.h"
 #include "utils/rel.h"
@@ -1668,6 +1669,9 @@ _bt_readpage(IndexScanDesc scan, ScanDirection dir, OffsetNumber offnum,
 	so->currPos.dir = dir;
 	so->currPos.nextTupleOffset = 0;
 
+	/* let index_getnext_tid callers recognize items from this batch */
+	scan->xs_batch_id++;
+
 	/* either moreRight or moreLeft should be set now (may be unset later) */
 	Assert(ScanDirectionIsForward(dir) ? so->currPos.moreRight :
 		   so->currPos.moreLeft);
@@ -1688,6 +1692,28 @@ _bt_readpage(IndexScanDesc scan, ScanDirection dir, OffsetNumber offnum,
 
 	PredicateLockPage(rel, so->currPos.currPage, scan->xs_snapshot);
 
+	/*
+	 * Once the scan has read more than one leaf page it is evidently a range
+	 * scan, so start the read of the sibling leaf page we expect to visit
+	 * next.  The prefetch overlaps that I/O with returning tuples from the
+	 * current page; on the first page we stay conservative to avoid wasted
+	 * reads for point lookups.  Parallel scans hand out pages through
+	 * _bt_parallel_seize, so the sibling may go to another worker; don't
+	 * second-guess that here.
+	 */
+	if (!firstpage && !scan->parallel_scan && effective_io_concurrency > 0)
+	{
+		BlockNumber next;
+
+		if (ScanDirectionIsForward(dir))
+			next = so->currPos.nextPage;
+		else
+			next = so->currPos.prevPage;
+
+		if (next != P_NONE)
+			PrefetchBuffer(rel, MAIN_FORKNUM, next);
+	}
+
 	/* initialize local variables */
 	indnatts = IndexRelationGetNumberOfAttributes(rel);
 	arrayKeys = so->numArrayKeys != 0;
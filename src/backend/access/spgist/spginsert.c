@@ -68,6 +68,19 @@ spgistBuildCallback(Relation index, ItemPointer tid, Datum *values,
 
 /*
  * Build an SP-GiST index.
+ *
+ * The build inserts tuples one at a time, descending from the root for
+ * each; there is no bottom-up sorted path like nbtsort.c's.  That is not
+ * an oversight: a btree's page layout is determined by a total order that
+ * exists independently of the data, so sorted input can be laid down as
+ * finished leaves.  An SP-GiST tree's shape is decided by the opclass's
+ * config/choose/picksplit callbacks as the data arrives — the partitions
+ * do not exist until the tuples that force the splits have been seen, and
+ * the AM API provides no way to enumerate an opclass's decomposition up
+ * front.  (GiST's sorted build needed a new opclass sortsupport hook for
+ * the same reason; the equivalent here would have to describe a radix
+ * hierarchy, not a sort order.)  Until an opclass can declare that,
+ * one-at-a-time descent is the build.
  */
 IndexBuildResult *
 spgbuild(Relation heap, Relation index, IndexInfo *indexInfo)
@@ -560,11 +560,24 @@ table_block_parallelscan_nextpage(Relation rel,
 		 * PARALLEL_SEQSCAN_RAMPDOWN_CHUNKS at the new size.  After a few
 		 * iterations of this, we'll end up doing the last few blocks with the
 		 * chunk size set to 1.
+		 *
+		 * Base the decision on the scan's global allocation progress rather
+		 * than this worker's last claim, which may be arbitrarily stale if
+		 * the worker spent a long time on its previous chunk; and keep
+		 * halving until the size fits what's left, so a late-returning
+		 * worker can't grab a full-size chunk at the tail of the scan and
+		 * leave everyone else idle waiting for it.
 		 */
-		if (pbscanwork->phsw_chunk_size > 1 &&
-			pbscanwork->phsw_nallocated > pbscan->phs_nblocks -
-			(pbscanwork->phsw_chunk_size * PARALLEL_SEQSCAN_RAMPDOWN_CHUNKS))
-			pbscanwork->phsw_chunk_size >>= 1;
+		if (pbscanwork->phsw_chunk_size > 1)
+		{
+			uint64		nalloc_global =
+				pg_atomic_read_u64(&pbscan->phs_nallocated);
+
+			while (pbscanwork->phsw_chunk_size > 1 &&
+				   nalloc_global > pbscan->phs_nblocks -
+				   (pbscanwork->phsw_chunk_size * PARALLEL_SEQSCAN_RAMPDOWN_CHUNKS))
+				pbscanwork->phsw_chunk_size >>= 1;
+		}
 
 		nallocated = pbscanwork->phsw_nallocated =
 			pg_atomic_fetch_add_u64(&pbscan->phs_nallocated,
@@ -344,21 +344,35 @@ static MultiXactId *OldestVisibleMXactId;
  * We use this cache to store known MultiXacts, so we don't need to go to
  * SLRU areas every time.
  *
- * The cache lasts for the duration of a single transaction, the rationale
- * for this being that most entries will contain our own TransactionId and
- * so they will be uninteresting by the time our next transaction starts.
- * (XXX not clear that this is correct --- other members of the MultiXact
- * could hang around longer than we did.  However, it's not clear what a
- * better policy for flushing old cache entries would be.)	FIXME actually
- * this is plain wrong now that multixact's may contain update Xids.
- *
- * We allocate the cache entries in a memory context that is deleted at
- * transaction end, so we don't need to do retail freeing of entries.
+ * The cache lasts for the lifetime of the backend.  A multixact's member
+ * set is immutable for as long as the multixact exists, so entries used
+ * for lookup (mXactCacheGetById) stay valid across transactions; this
+ * matters for workloads where foreign keys make many row locks resolve
+ * the same recently-created multixacts.  The one hazard is a multixact
+ * being truncated away and its ID eventually reused after wraparound, so
+ * we prune entries that have fallen behind the cluster's oldest multixact
+ * at transaction end and again before the first lookup of each new
+ * transaction, after pinning our OldestVisibleMXactId entry (see
+ * GetMultiXactIdMembers) — between transactions the backend holds no
+ * horizon, so truncation can overtake the cache while we're idle.  Within
+ * a transaction the pinned entry and the wraparound stop limits prevent
+ * reuse of anything that survived the prune.
+ *
+ * Reusing a cached multixact instead of creating a new one
+ * (mXactCacheGetBySet) is different: it is only safe for multixacts this
+ * transaction created itself, since those are protected against
+ * truncation by our OldestMemberMXactId entry.  Entries are therefore
+ * stamped with the creating transaction's local ID, and set lookups
+ * match only entries from the current transaction.
+ *
+ * We allocate the cache entries in a dedicated memory context, and free
+ * pruned entries individually.
  */
 typedef struct mXactCacheEnt
 {
 	MultiXactId multi;
 	int			nmembers;
+	LocalTransactionId lxid;	/* transaction that cached this entry */
 	dlist_node	node;
 	MultiXactMember members[FLEXIBLE_ARRAY_MEMBER];
 } mXactCacheEnt;
@@ -393,6 +407,7 @@ static MultiXactId mXactCacheGetBySet(int nmembers, MultiXactMember *members);
 static int	mXactCacheGetById(MultiXactId multi, MultiXactMember **members);
 static void mXactCachePut(MultiXactId multi, int nmembers,
 						  MultiXactMember *members);
+static void mXactCachePrune(void);
 
 /* management of SLRU infrastructure */
 static bool MultiXactOffsetPagePrecedes(int64 page1, int64 page2);
@@ -1314,6 +1329,24 @@ GetMultiXactIdMembers(MultiXactId multi, MultiXactMember **members,
 		return -1;
 	}
 
+	/*
+	 * Set our OldestVisibleMXactId[] entry if we didn't already, and do so
+	 * before consulting the cache.  Between transactions this backend holds
+	 * no multixact horizon, so multixacts we cached earlier may have been
+	 * truncated away in the meantime — or, after a full cycle of the
+	 * counter, have had their IDs reused for different member sets.  On the
+	 * first lookup of each transaction, therefore, prune entries that have
+	 * fallen behind the cluster's oldest multixact before trusting any of
+	 * them.  Once our entry is set, the survivors are protected from
+	 * truncation (and the wraparound stop limits prevent ID reuse) for the
+	 * rest of the transaction.
+	 */
+	if (!MultiXactIdIsValid(OldestVisibleMXactId[MyProcNumber]))
+	{
+		MultiXactIdSetOldestVisible();
+		mXactCachePrune();
+	}
+
 	/* See if the MultiXactId is in the local cache */
 	length = mXactCacheGetById(multi, members);
 	if (length >= 0)
@@ -1323,9 +1356,6 @@ GetMultiXactIdMembers(MultiXactId multi, MultiXactMember **members,
 		return length;
 	}
 
-	/* Set our OldestVisibleMXactId[] entry if we didn't already */
-	MultiXactIdSetOldestVisible();
-
 	/*
 	 * If we know the multi is used only for locking and not for updates, then
 	 * we can skip checking if the value is older than our oldest visible
@@ -1622,6 +1652,13 @@ mXactCacheGetBySet(int nmembers, MultiXactMember *members)
 		mXactCacheEnt *entry = dclist_container(mXactCacheEnt, node,
 												iter.cur);
 
+		/*
+		 * Only multixacts created by the current transaction may be reused;
+		 * see the comments above mXactCacheEnt.
+		 */
+		if (entry->lxid != MyProc->vxid.lxid)
+			continue;
+
 		if (entry->nmembers != nmembers)
 			continue;
 
@@ -1706,9 +1743,9 @@ mXactCachePut(MultiXactId multi, int nmembers, MultiXactMember *members)
 
 	if (MXactContext == NULL)
 	{
-		/* The cache only lives as long as the current transaction */
+		/* The cache lives for the rest of the backend's lifetime */
 		debug_elog2(DEBUG2, "CachePut: initializing memory context");
-		MXactContext = AllocSetContextCreate(TopTransactionContext,
+		MXactContext = AllocSetContextCreate(TopMemoryContext,
 											 "MultiXact cache context",
 											 ALLOCSET_SMALL_SIZES);
 	}
@@ -1720,6 +1757,7 @@ mXactCachePut(MultiXactId multi, int nmembers, MultiXactMember *members)
 
 	entry->multi = multi;
 	entry->nmembers = nmembers;
+	entry->lxid = MyProc->vxid.lxid;
 	memcpy(entry->members, members, nmembers * sizeof(MultiXactMember));
 
 	/* mXactCacheGetBySet assumes the entries are sorted, so sort them */
@@ -1741,6 +1779,45 @@ mXactCachePut(MultiXactId multi, int nmembers, MultiXactMember *members)
 	}
 }
 
+/*
+ * mXactCachePrune
+ *		Remove cache entries that are no longer safe to keep.
+ *
+ * This is called at transaction end, and again before the first cache
+ * lookup of each transaction (after OldestVisibleMXactId has been pinned;
+ * see GetMultiXactIdMembers).  Entries that precede the cluster's oldest
+ * multixact may be truncated away, after which their IDs could eventually
+ * be reused for different member sets, so drop them.  Everything else
+ * remains valid: member sets are immutable while a multixact exists.
+ */
+static void
+mXactCachePrune(void)
+{
+	MultiXactId oldestMXact;
+	dlist_mutable_iter iter;
+
+	if (dclist_is_empty(&MXactCache))
+		return;
+
+	LWLockAcquire(MultiXactGenLock, LW_SHARED);
+	oldestMXact = MultiXactState->oldestMultiXactId;
+	LWLockRelease(MultiXactGenLock);
+
+	dclist_foreach_modify(iter, &MXactCache)
+	{
+		mXactCacheEnt *entry = dclist_container(mXactCacheEnt, node,
+												iter.cur);
+
+		if (MultiXactIdPrecedes(entry->multi, oldestMXact))
+		{
+			debug_elog3(DEBUG2, "CachePrune: dropping cached multi %u",
+						entry->multi);
+			dclist_delete_from(&MXactCache, &entry->node);
+			pfree(entry);
+		}
+	}
+}
+
 char *
 mxstatus_to_string(MultiXactStatus status)
 {
@@ -1809,11 +1886,10 @@ AtEOXact_MultiXact(void)
 	OldestVisibleMXactId[MyProcNumber] = InvalidMultiXactId;
 
 	/*
-	 * Discard the local MultiXactId cache.  Since MXactContext was created as
-	 * a child of TopTransactionContext, we needn't delete it explicitly.
+	 * The local MultiXactId cache is kept across transactions, but entries
+	 * that could be affected by future truncation must go.
 	 */
-	MXactContext = NULL;
-	dclist_init(&MXactCache);
+	mXactCachePrune();
 }
 
 /*
@@ -1876,10 +1952,9 @@ PostPrepare_MultiXact(FullTransactionId fxid)
 	OldestVisibleMXactId[MyProcNumber] = InvalidMultiXactId;
 
 	/*
-	 * Discard the local MultiXactId cache like in AtEOXact_MultiXact.
+	 * Prune the local MultiXactId cache like in AtEOXact_MultiXact.
 	 */
-	MXactContext = NULL;
-	dclist_init(&MXactCache);
+	mXactCachePrune();
 }
 
 /*
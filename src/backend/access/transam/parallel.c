@@ -16,6 +16,8 @@
 
 #include "access/brin.h"
 #include "access/gin.h"
+#include "access/gist_private.h"
+#include "access/hash.h"
 #include "access/nbtree.h"
 #include "access/parallel.h"
 #include "access/session.h"
@@ -152,6 +154,12 @@ static const struct
 	{
 		"_gin_parallel_build_main", _gin_parallel_build_main
 	},
+	{
+		"_gist_parallel_build_main", _gist_parallel_build_main
+	},
+	{
+		"_hash_parallel_build_main", _hash_parallel_build_main
+	},
 	{
 		"parallel_vacuum_main", parallel_vacuum_main
 	}
@@ -573,9 +581,10 @@ void
 LaunchParallelWorkers(ParallelContext *pcxt)
 {
 	MemoryContext oldcontext;
-	BackgroundWorker worker;
+	BackgroundWorker *workers;
+	BackgroundWorkerHandle **handles;
+	int			nregistered;
 	int			i;
-	bool		any_registrations_failed = false;
 
 	/* Skip this if we have no workers. */
 	if (pcxt->nworkers == 0 || pcxt->nworkers_to_launch == 0)
@@ -590,58 +599,68 @@ LaunchParallelWorkers(ParallelContext *pcxt)
 	/* We might be running in a short-lived memory context. */
 	oldcontext = MemoryContextSwitchTo(TopTransactionContext);
 
-	/* Configure a worker. */
-	memset(&worker, 0, sizeof(worker));
-	snprintf(worker.bgw_name, BGW_MAXLEN, "parallel worker for PID %d",
-			 MyProcPid);
-	snprintf(worker.bgw_type, BGW_MAXLEN, "parallel worker");
-	worker.bgw_flags =
-		BGWORKER_SHMEM_ACCESS | BGWORKER_BACKEND_DATABASE_CONNECTION
-		| BGWORKER_CLASS_PARALLEL;
-	worker.bgw_start_time = BgWorkerStart_ConsistentState;
-	worker.bgw_restart_time = BGW_NEVER_RESTART;
-	sprintf(worker.bgw_library_name, "postgres");
-	sprintf(worker.bgw_function_name, "ParallelWorkerMain");
-	worker.bgw_main_arg = UInt32GetDatum(dsm_segment_handle(pcxt->seg));
-	worker.bgw_notify_pid = MyProcPid;
+	/*
+	 * Configure the workers.  They differ only in bgw_extra, which carries
+	 * each worker's ParallelWorkerNumber.
+	 */
+	workers = palloc0(pcxt->nworkers_to_launch * sizeof(BackgroundWorker));
+	handles = palloc(pcxt->nworkers_to_launch * sizeof(BackgroundWorkerHandle *));
+	for (i = 0; i < pcxt->nworkers_to_launch; ++i)
+	{
+		BackgroundWorker *worker = &workers[i];
+
+		snprintf(worker->bgw_name, BGW_MAXLEN, "parallel worker for PID %d",
+				 MyProcPid);
+		snprintf(worker->bgw_type, BGW_MAXLEN, "parallel worker");
+		worker->bgw_flags =
+			BGWORKER_SHMEM_ACCESS | BGWORKER_BACKEND_DATABASE_CONNECTION
+			| BGWORKER_CLASS_PARALLEL;
+		worker->bgw_start_time = BgWorkerStart_ConsistentState;
+		worker->bgw_restart_time = BGW_NEVER_RESTART;
+		sprintf(worker->bgw_library_name, "postgres");
+		sprintf(worker->bgw_function_name, "ParallelWorkerMain");
+		worker->bgw_main_arg = UInt32GetDatum(dsm_segment_handle(pcxt->seg));
+		worker->bgw_notify_pid = MyProcPid;
+		memcpy(worker->bgw_extra, &i, sizeof(int));
+	}
 
 	/*
-	 * Start workers.
+	 * Start workers, registering the whole batch at once so that the
+	 * postmaster is signaled only once for all of them.
 	 *
 	 * The caller must be able to tolerate ending up with fewer workers than
 	 * expected, so there is no need to throw an error here if registration
-	 * fails.  It wouldn't help much anyway, because registering the worker in
-	 * no way guarantees that it will start up and initialize successfully.
+	 * falls short.  It wouldn't help much anyway, because registering the
+	 * worker in no way guarantees that it will start up and initialize
+	 * successfully.
 	 */
-	for (i = 0; i < pcxt->nworkers_to_launch; ++i)
+	nregistered = RegisterDynamicBackgroundWorkers(workers,
+												   pcxt->nworkers_to_launch,
+												   handles);
+	for (i = 0; i < nregistered; ++i)
 	{
-		memcpy(worker.bgw_extra, &i, sizeof(int));
-		if (!any_registrations_failed &&
-			RegisterDynamicBackgroundWorker(&worker,
-											&pcxt->worker[i].bgwhandle))
-		{
-			shm_mq_set_handle(pcxt->worker[i].error_mqh,
-							  pcxt->worker[i].bgwhandle);
-			pcxt->nworkers_launched++;
-		}
-		else
-		{
-			/*
-			 * If we weren't able to register the worker, then we've bumped up
-			 * against the max_worker_processes limit, and future
-			 * registrations will probably fail too, so arrange to skip them.
-			 * But we still have to execute this code for the remaining slots
-			 * to make sure that we forget about the error queues we budgeted
-			 * for those workers.  Otherwise, we'll wait for them to start,
-			 * but they never will.
-			 */
-			any_registrations_failed = true;
-			pcxt->worker[i].bgwhandle = NULL;
-			shm_mq_detach(pcxt->worker[i].error_mqh);
-			pcxt->worker[i].error_mqh = NULL;
-		}
+		pcxt->worker[i].bgwhandle = handles[i];
+		shm_mq_set_handle(pcxt->worker[i].error_mqh,
+						  pcxt->worker[i].bgwhandle);
+		pcxt->nworkers_launched++;
 	}
 
+	/*
+	 * For workers that didn't get registered, we've bumped up against the
+	 * max_worker_processes limit.  We still have to forget about the error
+	 * queues we budgeted for those workers.  Otherwise, we'll wait for them
+	 * to start, but they never will.
+	 */
+	for (i = nregistered; i < pcxt->nworkers_to_launch; ++i)
+	{
+		pcxt->worker[i].bgwhandle = NULL;
+		shm_mq_detach(pcxt->worker[i].error_mqh);
+		pcxt->worker[i].error_mqh = NULL;
+	}
+
+	pfree(workers);
+	pfree(handles);
+
 	/*
 	 * Now that nworkers_launched has taken its final value, we can initialize
 	 * known_attached_workers.
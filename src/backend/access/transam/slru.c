@@ -217,7 +217,7 @@ SimpleLruShmemSize(int nslots, int nlsns)
 	if (nlsns > 0)
 		sz += MAXALIGN(nslots * nlsns * sizeof(XLogRecPtr));	/* group_lsn[] */
 
-	return BUFFERALIGN(sz) + BLCKSZ * nslots;
+	return BUFFERALIGN(sz) + BLCKSZ * (Size) nslots;
 }
 
 /*
@@ -1205,31 +1205,30 @@ SlruSelectLRUPage(SlruCtl ctl, int64 pageno)
 		int			bestinvalidslot = 0;	/* keep compiler quiet */
 		int			best_invalid_delta = -1;
 		int64		best_invalid_page_number = 0;	/* keep compiler quiet */
+		int			emptyslot = -1;
 		int			bankno = pageno % ctl->nbanks;
 		int			bankstart = bankno * SLRU_BANK_SIZE;
 		int			bankend = bankstart + SLRU_BANK_SIZE;
 
 		Assert(LWLockHeldByMe(SimpleLruGetBankLock(ctl, pageno)));
 
-		/* See if page already has a buffer assigned */
-		for (int slotno = bankstart; slotno < bankend; slotno++)
-		{
-			if (shared->page_status[slotno] != SLRU_PAGE_EMPTY &&
-				shared->page_number[slotno] == pageno)
-				return slotno;
-		}
-
 		/*
-		 * If we find any EMPTY slot, just select that one. Else choose a
-		 * victim page to replace.  We normally take the least recently used
-		 * valid page, but we will never take the slot containing
-		 * latest_page_number, even if it appears least recently used.  We
-		 * will select a slot that is already I/O busy only if there is no
-		 * other choice: a read-busy slot will not be least recently used once
-		 * the read finishes, and waiting for an I/O on a write-busy slot is
-		 * inferior to just picking some other slot.  Testing shows the slot
-		 * we pick instead will often be clean, allowing us to begin a read at
-		 * once.
+		 * Make a single pass over the bank, checking whether the page already
+		 * has a buffer assigned (possible when some other process read it in
+		 * while we were doing I/O to free a slot, so we must recheck on every
+		 * iteration of the outer loop) and simultaneously gathering eviction
+		 * candidates in case it doesn't.
+		 *
+		 * If the page is absent and we saw any EMPTY slot, just select that
+		 * one.  Else choose a victim page to replace.  We normally take the
+		 * least recently used valid page, but we will never take the slot
+		 * containing latest_page_number, even if it appears least recently
+		 * used.  We will select a slot that is already I/O busy only if there
+		 * is no other choice: a read-busy slot will not be least recently
+		 * used once the read finishes, and waiting for an I/O on a write-busy
+		 * slot is inferior to just picking some other slot.  Testing shows
+		 * the slot we pick instead will often be clean, allowing us to begin
+		 * a read at once.
 		 *
 		 * Normally the page_lru_count values will all be different and so
 		 * there will be a well-defined LRU page.  But since we allow
@@ -1253,6 +1252,14 @@ SlruSelectLRUPage(SlruCtl ctl, int64 pageno)
 			int64		this_page_number;
 
 			if (shared->page_status[slotno] == SLRU_PAGE_EMPTY)
+			{
+				if (emptyslot < 0)
+					emptyslot = slotno;
+				continue;
+			}
+
+			/* Done if this slot already holds the target page */
+			if (shared->page_number[slotno] == pageno)
 				return slotno;
 
 			this_delta = cur_count - shared->page_lru_count[slotno];
@@ -1305,6 +1312,10 @@ SlruSelectLRUPage(SlruCtl ctl, int64 pageno)
 			}
 		}
 
+		/* The page isn't present, so any empty slot is the best choice */
+		if (emptyslot >= 0)
+			return emptyslot;
+
 		/*
 		 * If all pages (except possibly the latest one) are I/O busy, we'll
 		 * have to wait for an I/O to complete and then retry.  In that
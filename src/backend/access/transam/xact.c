@@ -1512,6 +1512,17 @@ RecordTransactionCommit(void)
 		 synchronous_commit > SYNCHRONOUS_COMMIT_OFF) ||
 		forceSyncCommit || nrels > 0)
 	{
+		/*
+		 * Advertise our commit record to the WAL writer before blocking in
+		 * XLogFlush.  If the WAL writer (or a concurrently committing
+		 * backend) gets the flush done, or at least under way, while we're
+		 * still queueing for WALWriteLock, XLogFlush's recheck will find
+		 * less - or no - work left to do.  This effectively turns the flush
+		 * wait into a completion wait whenever there's any concurrent flush
+		 * activity, at the cost of one spinlock cycle here.
+		 */
+		XLogSetAsyncXactLSN(XactLastRecEnd);
+
 		XLogFlush(XactLastRecEnd);
 
 		/*
@@ -147,9 +147,14 @@ int			wal_segment_size = DEFAULT_XLOG_SEG_SIZE;
 /*
  * Number of WAL insertion locks to use. A higher value allows more insertions
  * to happen concurrently, but adds some CPU overhead to flushing the WAL,
- * which needs to iterate all the locks.
+ * which needs to iterate all the locks.  The actual count is fixed once at
+ * shared-memory sizing time, scaled from MaxBackends between the bounds
+ * below, so high-concurrency systems aren't limited to eight insertion
+ * streams while small ones don't pay extra flush-side iteration.
  */
-#define NUM_XLOGINSERT_LOCKS  8
+#define MIN_XLOGINSERT_LOCKS	8
+#define MAX_XLOGINSERT_LOCKS	64
+static int	NumXLogInsertLocks = 0;
 
 /*
  * Max distance from last checkpoint, before triggering a new xlog-based
@@ -804,7 +809,7 @@ XLogInsertRecord(XLogRecData *rdata,
 	 * inserter acquires an insertion lock. In addition to just indicating that
 	 * an insertion is in progress, the lock tells others how far the inserter
 	 * has progressed. There is a small fixed number of insertion locks,
-	 * determined by NUM_XLOGINSERT_LOCKS. When an inserter crosses a page
+	 * determined by NumXLogInsertLocks. When an inserter crosses a page
 	 * boundary, it updates the value stored in the lock to the how far it has
 	 * inserted, to allow the previous buffer to be flushed.
 	 *
@@ -1392,7 +1397,7 @@ WALInsertLockAcquire(void)
 	static int	lockToTry = -1;
 
 	if (lockToTry == -1)
-		lockToTry = MyProcNumber % NUM_XLOGINSERT_LOCKS;
+		lockToTry = MyProcNumber % NumXLogInsertLocks;
 	MyLockNo = lockToTry;
 
 	/*
@@ -1410,7 +1415,7 @@ WALInsertLockAcquire(void)
 		 * than locks, it still helps to distribute the inserters evenly
 		 * across the locks.
 		 */
-		lockToTry = (lockToTry + 1) % NUM_XLOGINSERT_LOCKS;
+		lockToTry = (lockToTry + 1) % NumXLogInsertLocks;
 	}
 }
 
@@ -1428,7 +1433,7 @@ WALInsertLockAcquireExclusive(void)
 	 * indicator is set to 0xFFFFFFFFFFFFFFFF, which is higher than any real
 	 * XLogRecPtr value, to make sure that no-one blocks waiting on those.
 	 */
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS - 1; i++)
+	for (i = 0; i < NumXLogInsertLocks - 1; i++)
 	{
 		LWLockAcquire(&WALInsertLocks[i].l.lock, LW_EXCLUSIVE);
 		LWLockUpdateVar(&WALInsertLocks[i].l.lock,
@@ -1454,7 +1459,7 @@ WALInsertLockRelease(void)
 	{
 		int			i;
 
-		for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+		for (i = 0; i < NumXLogInsertLocks; i++)
 			LWLockReleaseClearVar(&WALInsertLocks[i].l.lock,
 								  &WALInsertLocks[i].l.insertingAt,
 								  0);
@@ -1482,8 +1487,8 @@ WALInsertLockUpdateInsertingAt(XLogRecPtr insertingAt)
 		 * We use the last lock to mark our actual position, see comments in
 		 * WALInsertLockAcquireExclusive.
 		 */
-		LWLockUpdateVar(&WALInsertLocks[NUM_XLOGINSERT_LOCKS - 1].l.lock,
-						&WALInsertLocks[NUM_XLOGINSERT_LOCKS - 1].l.insertingAt,
+		LWLockUpdateVar(&WALInsertLocks[NumXLogInsertLocks - 1].l.lock,
+						&WALInsertLocks[NumXLogInsertLocks - 1].l.insertingAt,
 						insertingAt);
 	}
 	else
@@ -1559,7 +1564,7 @@ WaitXLogInsertionsToFinish(XLogRecPtr upto)
 	 * out for any insertion that's still in progress.
 	 */
 	finishedUpto = reservedUpto;
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+	for (i = 0; i < NumXLogInsertLocks; i++)
 	{
 		XLogRecPtr	insertingat = InvalidXLogRecPtr;
 
@@ -3730,6 +3735,73 @@ PreallocXlogFiles(XLogRecPtr endptr, TimeLineID tli)
 	}
 }
 
+/*
+ * Maintain a pool of pre-created WAL segments ahead of the insert position.
+ *
+ * Zero-filling a new segment in XLogFileInitInternal() is done inline by
+ * whichever backend first crosses the segment boundary, which shows up as a
+ * commit latency spike.  Checkpoints normally hide that cost by recycling
+ * old segments, and PreallocXlogFiles() adds at most one future segment per
+ * checkpoint, but a burst of WAL can outrun both.  This function, called
+ * periodically from the walwriter, keeps enough future segments ready to
+ * cover about twice the recently observed consumption rate, so foreground
+ * processes only ever open segments that already exist.
+ */
+#define XLOG_PREALLOC_MAX_SEGS	16
+
+void
+XLogBackgroundPrealloc(void)
+{
+	static XLogSegNo prev_segno = 0;
+	static XLogSegNo prepared_upto = 0;
+	static double segs_per_cycle = 0.0;
+	XLogSegNo	cur_segno;
+	XLogSegNo	target_segno;
+	TimeLineID	tli;
+	int			lookahead;
+
+	if (!XLogCtl->InstallXLogFileSegmentActive)
+		return;					/* unlocked check says no */
+
+	XLByteToSeg(GetXLogInsertRecPtr(), cur_segno, wal_segment_size);
+
+	if (prev_segno == 0)
+		prev_segno = cur_segno;
+
+	/*
+	 * Track the recent WAL consumption rate, in segments per walwriter
+	 * cycle, as a decaying average.  This reacts within a few cycles to a
+	 * bulk load starting up, while a single outlier cycle doesn't cause a
+	 * burst of segment creation.
+	 */
+	segs_per_cycle = 0.75 * segs_per_cycle +
+		0.25 * (double) (cur_segno - prev_segno);
+	prev_segno = cur_segno;
+
+	lookahead = 1 + (int) (2.0 * segs_per_cycle);
+	lookahead = Min(lookahead, XLOG_PREALLOC_MAX_SEGS);
+
+	target_segno = cur_segno + lookahead;
+	if (target_segno <= prepared_upto)
+		return;					/* pool is already deep enough */
+
+	tli = GetWALInsertionTimeLine();
+
+	for (XLogSegNo segno = Max(cur_segno + 1, prepared_upto + 1);
+		 segno <= target_segno;
+		 segno++)
+	{
+		char		path[MAXPGPATH];
+		bool		added;
+		int			lf;
+
+		lf = XLogFileInitInternal(segno, tli, &added, path);
+		if (lf >= 0)
+			close(lf);
+	}
+	prepared_upto = target_segno;
+}
+
 /*
  * Throws an error if the given log segment has already been removed or
  * recycled. The caller should only pass a segment that it knows to have
@@ -4949,11 +5021,19 @@ XLOGShmemSize(void)
 	}
 	Assert(XLOGbuffers > 0);
 
+	/*
+	 * Likewise settle the number of WAL insertion locks, now that MaxBackends
+	 * is known.  The value must not change between the sizing and init calls.
+	 */
+	if (NumXLogInsertLocks == 0)
+		NumXLogInsertLocks = Min(MAX_XLOGINSERT_LOCKS,
+								 Max(MIN_XLOGINSERT_LOCKS, MaxBackends / 8));
+
 	/* XLogCtl */
 	size = sizeof(XLogCtlData);
 
 	/* WAL insertion locks, plus alignment */
-	size = add_size(size, mul_size(sizeof(WALInsertLockPadded), NUM_XLOGINSERT_LOCKS + 1));
+	size = add_size(size, mul_size(sizeof(WALInsertLockPadded), NumXLogInsertLocks + 1));
 	/* xlblocks array */
 	size = add_size(size, mul_size(sizeof(pg_atomic_uint64), XLOGbuffers));
 	/* extra alignment padding for XLOG I/O buffers */
@@ -5046,9 +5126,9 @@ XLOGShmemInit(void)
 		((uintptr_t) allocptr) % sizeof(WALInsertLockPadded);
 	WALInsertLocks = XLogCtl->Insert.WALInsertLocks =
 		(WALInsertLockPadded *) allocptr;
-	allocptr += sizeof(WALInsertLockPadded) * NUM_XLOGINSERT_LOCKS;
+	allocptr += sizeof(WALInsertLockPadded) * NumXLogInsertLocks;
 
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+	for (i = 0; i < NumXLogInsertLocks; i++)
 	{
 		LWLockInitialize(&WALInsertLocks[i].l.lock, LWTRANCHE_WAL_INSERT);
 		pg_atomic_init_u64(&WALInsertLocks[i].l.insertingAt, InvalidXLogRecPtr);
@@ -6630,7 +6710,7 @@ GetLastImportantRecPtr(void)
 	XLogRecPtr	res = InvalidXLogRecPtr;
 	int			i;
 
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+	for (i = 0; i < NumXLogInsertLocks; i++)
 	{
 		XLogRecPtr	last_important;
 
@@ -8663,7 +8743,7 @@ xlog_redo(XLogReaderState *record)
 
 /*
  * Return the extra open flags used for opening a file, depending on the
- * value of the GUCs wal_sync_method, fsync and debug_io_direct.
+ * value of the GUCs wal_sync_method, fsync and io_direct.
  */
 static int
 get_sync_bit(int method)
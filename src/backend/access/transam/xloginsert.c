@@ -404,6 +404,12 @@ XLogRegisterData(const void *data, uint32 len)
  * reconstruct the changes to the page, you might as well just log a full
  * copy of it. (the "main data" that's not associated with a block is not
  * limited)
+ *
+ * The data is not copied here: the rdata chain just points at it, and the
+ * payload bytes are copied exactly once, straight into the WAL buffers, by
+ * CopyXLogRecordToWAL at insertion time.  (Full-page images are referenced
+ * in place the same way, unless they are compressed.)  The caller must
+ * keep the data valid and unchanged until XLogInsert() returns.
  */
 void
 XLogRegisterBufData(uint8 block_id, const void *data, uint32 len)
@@ -961,6 +967,15 @@ XLogRecordAssemble(RmgrId rmid, uint8 info,
  * Returns false if compression fails (i.e., compressed result is actually
  * bigger than original). Otherwise, returns true and sets 'dlen' to
  * the length of compressed block image.
+ *
+ * Each image must compress independently, even though successive images of
+ * the same page are often near-identical.  Encoding an image as a delta
+ * against an earlier one would defeat the purpose of full-page writes: the
+ * image is what lets redo recover from a torn page without trusting any
+ * prior state, and recovery may begin at a checkpoint after the would-be
+ * base image has left the WAL range being replayed.  Reducing FPI volume
+ * means taking fewer images (longer checkpoint intervals), not making the
+ * images depend on each other.
  */
 static bool
 XLogCompressBackupBlock(const PageData *page, uint16 hole_offset, uint16 hole_length,
@@ -1802,9 +1802,11 @@ PerformWalRecovery(void)
 				recoveryPausesHere(false);
 
 			/*
-			 * Have we reached our recovery target?
+			 * Have we reached our recovery target?  (Recovery targets only
+			 * apply to archive recovery; in crash recovery, don't pay for
+			 * the check on every record.)
 			 */
-			if (recoveryStopsBefore(xlogreader))
+			if (ArchiveRecoveryRequested && recoveryStopsBefore(xlogreader))
 			{
 				reachedRecoveryTarget = true;
 				break;
@@ -1833,7 +1835,7 @@ PerformWalRecovery(void)
 			ApplyWalRecord(xlogreader, record, &replayTLI);
 
 			/* Exit loop if we reached inclusive recovery target */
-			if (recoveryStopsAfter(xlogreader))
+			if (ArchiveRecoveryRequested && recoveryStopsAfter(xlogreader))
 			{
 				reachedRecoveryTarget = true;
 				break;
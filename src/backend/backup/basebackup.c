@@ -3,6 +3,19 @@
  * basebackup.c
  *	  code for taking a base backup and streaming it to a standby
  *
+ * A backup is one walsender streaming one tar stream per tablespace,
+ * sequentially, through a single bbsink chain.  Running several senders
+ * that each ship a partition of the files would need the backup itself to
+ * become a shared, multi-process object: do_pg_backup_start/stop bracket
+ * exactly one session today, the WAL begin/end points and the manifest
+ * must cover all streams as a unit, and a failure in any stream has to
+ * abort the others and release the shared state.  None of that is
+ * conceptually hard, but it is a replication-protocol change (client and
+ * server negotiate N connections for one backup), not a local change
+ * here.  Meanwhile the common bottlenecks have cheaper answers: server-
+ * or client-side compression moves the bytes-per-second ceiling, and
+ * incremental backups shrink the bytes.
+ *
  * Portions Copyright (c) 2010-2025, PostgreSQL Global Development Group
  *
  * IDENTIFICATION
@@ -953,6 +953,9 @@ InsertPgClassTuple(Relation pg_class_desc,
 	values[Anum_pg_class_relrewrite - 1] = ObjectIdGetDatum(rd_rel->relrewrite);
 	values[Anum_pg_class_relfrozenxid - 1] = TransactionIdGetDatum(rd_rel->relfrozenxid);
 	values[Anum_pg_class_relminmxid - 1] = MultiXactIdGetDatum(rd_rel->relminmxid);
+	values[Anum_pg_class_relvacresumexid - 1] = TransactionIdGetDatum(rd_rel->relvacresumexid);
+	values[Anum_pg_class_relvacresumemxid - 1] = MultiXactIdGetDatum(rd_rel->relvacresumemxid);
+	values[Anum_pg_class_relvacresumeblock - 1] = Int32GetDatum(rd_rel->relvacresumeblock);
 	if (relacl != (Datum) 0)
 		values[Anum_pg_class_relacl - 1] = relacl;
 	else
@@ -3345,6 +3345,17 @@ IndexCheckExclusion(Relation heapRelation,
  * cleverer, eg storing new tuples in a special area of the table (perhaps
  * making the table append-only by setting use_fsm).  However that would
  * add yet more locking issues.
+ *
+ * Another oft-proposed refinement is to have concurrent writers record the
+ * TIDs they insert during the build phase (say in a shared TidStore), so
+ * that validation visits only those TIDs instead of rescanning the heap.
+ * But the tuples validation must find are precisely the ones inserted by
+ * transactions that were *not* aware of the index — transactions already
+ * running when indisready was set — and asking unaware backends to track
+ * TIDs for us is the same coordination problem as having them insert into
+ * the index directly, plus new questions about the store's lifetime if the
+ * build errors out.  Transactions that do see indisready already maintain
+ * the index themselves, which is why their tuples need no validation pass.
  */
 void
 validate_index(Oid heapId, Oid indexId, Snapshot snapshot)
@@ -234,6 +234,40 @@ analyze_rel(Oid relid, RangeVar *relation,
 		return;
 	}
 
+	/*
+	 * If the SKIP_UNCHANGED option was given, consult the cumulative
+	 * statistics and skip the relation when nothing has been modified since
+	 * it was last analyzed.  The counters are approximate --- in particular,
+	 * changes made by transactions that have not yet flushed their stats may
+	 * be missing --- so this is a heuristic, and when in doubt we analyze.
+	 * The check is limited to plain tables and materialized views without
+	 * children: partitioned and inheritance parents never accumulate
+	 * modification counts of their own, and foreign tables have no counters
+	 * at all, so for those "unchanged" would be indistinguishable from
+	 * "unknown".
+	 */
+	if ((params.options & VACOPT_SKIP_UNCHANGED) &&
+		(onerel->rd_rel->relkind == RELKIND_RELATION ||
+		 onerel->rd_rel->relkind == RELKIND_MATVIEW) &&
+		!onerel->rd_rel->relhassubclass)
+	{
+		PgStat_StatTabEntry *tabentry;
+
+		tabentry = pgstat_fetch_stat_tabentry_ext(onerel->rd_rel->relisshared,
+												  RelationGetRelid(onerel));
+		if (tabentry != NULL &&
+			tabentry->mod_since_analyze == 0 &&
+			(tabentry->analyze_count > 0 || tabentry->autoanalyze_count > 0))
+		{
+			ereport(elevel,
+					(errmsg("skipping analyze of \"%s.%s\" --- no changes since last analyze",
+							get_namespace_name(RelationGetNamespace(onerel)),
+							RelationGetRelationName(onerel))));
+			relation_close(onerel, ShareUpdateExclusiveLock);
+			return;
+		}
+	}
+
 	/*
 	 * OK, let's do it.  First, initialize progress reporting.
 	 */
@@ -246,6 +246,9 @@ typedef struct QueueBackendStatus
 	Oid			dboid;			/* backend's database OID, or InvalidOid */
 	ProcNumber	nextListener;	/* id of next listener, or INVALID_PROC_NUMBER */
 	QueuePosition pos;			/* backend has read queue up to here */
+	uint64		channelFilter;	/* Bloom filter over the channels this
+								 * backend is listening on; see
+								 * asyncNotifyChannelMask() */
 } QueueBackendStatus;
 
 /*
@@ -301,6 +304,7 @@ static AsyncQueueControl *asyncQueueControl;
 #define QUEUE_BACKEND_DBOID(i)		(asyncQueueControl->backend[i].dboid)
 #define QUEUE_NEXT_LISTENER(i)		(asyncQueueControl->backend[i].nextListener)
 #define QUEUE_BACKEND_POS(i)		(asyncQueueControl->backend[i].pos)
+#define QUEUE_BACKEND_FILTER(i)		(asyncQueueControl->backend[i].channelFilter)
 
 /*
  * The SLRU buffer area through which we access the notification queue
@@ -437,6 +441,8 @@ static void Exec_ListenCommit(const char *channel);
 static void Exec_UnlistenCommit(const char *channel);
 static void Exec_UnlistenAllCommit(void);
 static bool IsListeningOn(const char *channel);
+static uint64 asyncNotifyChannelMask(const char *channel);
+static void asyncQueueUpdateChannelFilter(void);
 static void asyncQueueUnregister(void);
 static bool asyncQueueIsFull(void);
 static bool asyncQueueAdvance(volatile QueuePosition *position, int entryLength);
@@ -526,6 +532,7 @@ AsyncShmemInit(void)
 			QUEUE_BACKEND_DBOID(i) = InvalidOid;
 			QUEUE_NEXT_LISTENER(i) = INVALID_PROC_NUMBER;
 			SET_QUEUE_POS(QUEUE_BACKEND_POS(i), 0, 0);
+			QUEUE_BACKEND_FILTER(i) = 0;
 		}
 	}
 
@@ -878,6 +885,18 @@ PreCommit_Notify(void)
 			{
 				case LISTEN_LISTEN:
 					Exec_ListenPreCommit();
+
+					/*
+					 * Conservatively add the channel to our shared filter
+					 * already, so that a notifier committing just after us
+					 * cannot skip us on the strength of a stale filter.
+					 * AtCommit_Notify and AtAbort_Notify recompute the
+					 * exact value.
+					 */
+					LWLockAcquire(NotifyQueueLock, LW_SHARED);
+					QUEUE_BACKEND_FILTER(MyProcNumber) |=
+						asyncNotifyChannelMask(actrec->channel);
+					LWLockRelease(NotifyQueueLock);
 					break;
 				case LISTEN_UNLISTEN:
 					/* there is no Exec_UnlistenPreCommit() */
@@ -1003,6 +1022,8 @@ AtCommit_Notify(void)
 	/* If no longer listening to anything, get out of listener array */
 	if (amRegisteredListener && listenChannels == NIL)
 		asyncQueueUnregister();
+	else if (pendingActions != NULL)
+		asyncQueueUpdateChannelFilter();
 
 	/*
 	 * Send signals to listening backends.  We need do this only if there are
@@ -1098,6 +1119,7 @@ Exec_ListenPreCommit(void)
 	QUEUE_BACKEND_POS(MyProcNumber) = max;
 	QUEUE_BACKEND_PID(MyProcNumber) = MyProcPid;
 	QUEUE_BACKEND_DBOID(MyProcNumber) = MyDatabaseId;
+	QUEUE_BACKEND_FILTER(MyProcNumber) = 0;
 	/* Insert backend into list of listeners at correct position */
 	if (prevListener != INVALID_PROC_NUMBER)
 	{
@@ -1222,6 +1244,52 @@ IsListeningOn(const char *channel)
 	return false;
 }
 
+/*
+ * Compute the Bloom filter bits for one channel name.
+ *
+ * Each channel sets two bits of a 64-bit word, derived from independent
+ * halves of a 64-bit hash.  A listener's shared filter is the OR of the
+ * masks of all channels it is listening on, so a notifying backend can
+ * cheaply test whether a listener might care about a given channel: if
+ * (filter & mask) != mask, it certainly does not.  False positives merely
+ * cause an unnecessary signal, which is what we'd always have sent before
+ * this filter existed.
+ */
+static uint64
+asyncNotifyChannelMask(const char *channel)
+{
+	uint64		h = DatumGetUInt64(hash_any_extended((const unsigned char *) channel,
+													 strlen(channel), 0));
+
+	return (UINT64CONST(1) << (h & 63)) | (UINT64CONST(1) << ((h >> 32) & 63));
+}
+
+/*
+ * Recompute our shared channel filter from listenChannels and publish it.
+ *
+ * This must be called after any committed change to listenChannels.  We
+ * recompute from scratch rather than trying to update incrementally, since
+ * bits cannot be removed from a Bloom filter; the list is short so this is
+ * cheap.  Holding NotifyQueueLock in shared mode suffices to update our own
+ * entry, per the locking rules atop AsyncQueueControl.
+ */
+static void
+asyncQueueUpdateChannelFilter(void)
+{
+	uint64		filter = 0;
+	ListCell   *p;
+
+	if (!amRegisteredListener)
+		return;
+
+	foreach(p, listenChannels)
+		filter |= asyncNotifyChannelMask((const char *) lfirst(p));
+
+	LWLockAcquire(NotifyQueueLock, LW_SHARED);
+	QUEUE_BACKEND_FILTER(MyProcNumber) = filter;
+	LWLockRelease(NotifyQueueLock);
+}
+
 /*
  * Remove our entry from the listeners array when we are no longer listening
  * on any channel.  NB: must not fail if we're already not listening.
@@ -1241,6 +1309,7 @@ asyncQueueUnregister(void)
 	/* Mark our entry as invalid */
 	QUEUE_BACKEND_PID(MyProcNumber) = InvalidPid;
 	QUEUE_BACKEND_DBOID(MyProcNumber) = InvalidOid;
+	QUEUE_BACKEND_FILTER(MyProcNumber) = 0;
 	/* and remove it from the list */
 	if (QUEUE_FIRST_LISTENER == MyProcNumber)
 		QUEUE_FIRST_LISTENER = QUEUE_NEXT_LISTENER(MyProcNumber);
@@ -1565,12 +1634,14 @@ asyncQueueFillWarning(void)
 /*
  * Send signals to listening backends.
  *
- * Normally we signal only backends in our own database, since only those
+ * Normally we signal only backends in our own database whose channel filter
+ * admits at least one of the channels being notified, since only those
  * backends could be interested in notifies we send.  However, if there's
- * notify traffic in our database but no traffic in another database that
- * does have listener(s), those listeners will fall further and further
- * behind.  Waken them anyway if they're far enough behind, so that they'll
- * advance their queue position pointers, allowing the global tail to advance.
+ * notify traffic in our database but no traffic on the channels of some
+ * listener (or no traffic in another database that does have listeners),
+ * those listeners will fall further and further behind.  Waken them anyway
+ * if they're far enough behind, so that they'll advance their queue position
+ * pointers, allowing the global tail to advance.
  *
  * Since we know the ProcNumber and the Pid the signaling is quite cheap.
  *
@@ -1583,6 +1654,38 @@ SignalBackends(void)
 	int32	   *pids;
 	ProcNumber *procnos;
 	int			count;
+	uint64		channelMasks[16];
+	int			nchannelMasks;
+	ListCell   *lc;
+
+	/*
+	 * Compute the filter masks of the channels we are notifying, so that we
+	 * can avoid waking listeners whose channel filter proves they are not
+	 * listening on any of them.  If there are more distinct channels than we
+	 * care to test per listener, don't bother filtering; that many channels
+	 * would saturate the listeners' filters anyway.
+	 */
+	nchannelMasks = 0;
+	foreach(lc, pendingNotifies->events)
+	{
+		Notification *n = (Notification *) lfirst(lc);
+		uint64		mask = asyncNotifyChannelMask(n->data);
+		int			j;
+
+		for (j = 0; j < nchannelMasks; j++)
+		{
+			if (channelMasks[j] == mask)
+				break;
+		}
+		if (j < nchannelMasks)
+			continue;			/* duplicate channel */
+		if (nchannelMasks >= lengthof(channelMasks))
+		{
+			nchannelMasks = -1; /* too many, disable filtering */
+			break;
+		}
+		channelMasks[nchannelMasks++] = mask;
+	}
 
 	/*
 	 * Identify backends that we need to signal.  We don't want to send
@@ -1612,6 +1715,31 @@ SignalBackends(void)
 			 */
 			if (QUEUE_POS_EQUAL(pos, QUEUE_HEAD))
 				continue;
+
+			/*
+			 * If the listener's channel filter shows that it cannot be
+			 * listening on any of the notified channels, treat it like a
+			 * listener in another database: signal it only once it's far
+			 * behind, so that its queue pointer still advances.
+			 */
+			if (nchannelMasks >= 0)
+			{
+				uint64		filter = QUEUE_BACKEND_FILTER(i);
+				bool		match = false;
+
+				for (int j = 0; j < nchannelMasks; j++)
+				{
+					if ((filter & channelMasks[j]) == channelMasks[j])
+					{
+						match = true;
+						break;
+					}
+				}
+				if (!match &&
+					asyncQueuePageDiff(QUEUE_POS_PAGE(QUEUE_HEAD),
+									   QUEUE_POS_PAGE(pos)) < QUEUE_CLEANUP_DELAY)
+					continue;
+			}
 		}
 		else
 		{
@@ -1677,6 +1805,11 @@ AtAbort_Notify(void)
 	 */
 	if (amRegisteredListener && listenChannels == NIL)
 		asyncQueueUnregister();
+	else if (pendingActions != NULL)
+	{
+		/* Remove any filter bits added speculatively by PreCommit_Notify */
+		asyncQueueUpdateChannelFilter();
+	}
 
 	/* And clean up */
 	ClearPendingActionsAndNotifies();
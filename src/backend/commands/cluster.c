@@ -306,6 +306,19 @@ cluster_multiple_rels(List *rtcs, ClusterParams *params)
  * If indexOid is InvalidOid, the table will be rewritten in physical order
  * instead of index order.  This is the new implementation of VACUUM FULL,
  * and error messages should refer to the operation as VACUUM not CLUSTER.
+ *
+ * The whole rewrite runs under AccessExclusiveLock.  An "online" variant —
+ * copy concurrently, capture changes with a transient logical slot, apply
+ * the delta, then swap under a brief lock, as pg_repack and pg_squeeze do
+ * externally — is well understood but is much more than relaxing the lock
+ * here: the table needs a replica identity for the delta to be applicable,
+ * DDL must be fenced off for the whole copy window, the apply path is a
+ * single-table logical replication subscriber inside a utility command,
+ * and an error or crash mid-run must clean up a slot, a shadow table, and
+ * captured-but-unapplied changes.  The swap itself (finish_heap_swap) is
+ * the easy part.  Any in-core version would be a new code path alongside
+ * this one, not a change to it, since the offline rewrite remains the
+ * right tool when the exclusive lock is affordable.
  */
 void
 cluster_rel(Relation OldHeap, Oid indexOid, ClusterParams *params)
@@ -1219,6 +1232,15 @@ swap_relation_files(Oid r1, Oid r2, bool target_is_pg_class,
 			   TransactionIdIsNormal(frozenXid));
 		relform1->relfrozenxid = frozenXid;
 		relform1->relminmxid = cutoffMulti;
+
+		/*
+		 * The rewritten heap's block layout has nothing in common with the
+		 * old one, so any saved aggressive-VACUUM resume point is now
+		 * meaningless (and following it would be unsafe).
+		 */
+		relform1->relvacresumexid = InvalidTransactionId;
+		relform1->relvacresumemxid = InvalidMultiXactId;
+		relform1->relvacresumeblock = 0;
 	}
 
 	/* swap size statistics too, since new rel has freshly-updated stats */
@@ -1545,6 +1567,9 @@ finish_heap_swap(Oid OIDOldHeap, Oid OIDNewHeap,
 
 		relform->relfrozenxid = frozenXid;
 		relform->relminmxid = cutoffMulti;
+		relform->relvacresumexid = InvalidTransactionId;
+		relform->relvacresumemxid = InvalidMultiXactId;
+		relform->relvacresumeblock = 0;
 
 		CatalogTupleUpdate(relRelation, &reltup->t_self, reltup);
 
@@ -1328,6 +1328,29 @@ CopyReadLineText(CopyFromState cstate, bool is_csv)
 			need_data = false;
 		}
 
+		/*
+		 * In text mode, approve ordinary characters in bulk: only newline,
+		 * carriage return and backslash need byte-at-a-time treatment, so
+		 * skip ahead to the next one of those before dropping into the
+		 * per-character logic.  (In CSV mode the quote/escape state machine
+		 * has to see every byte.)
+		 */
+		if (!is_csv)
+		{
+			while (input_buf_ptr < copy_buf_len)
+			{
+				char		c2 = copy_input_buf[input_buf_ptr];
+
+				if (c2 == '\n' || c2 == '\r' || c2 == '\\')
+					break;
+				input_buf_ptr++;
+			}
+
+			/* If we consumed the rest of the buffer, go refill it. */
+			if (input_buf_ptr >= copy_buf_len)
+				continue;
+		}
+
 		/* OK to fetch a character */
 		prev_raw_ptr = input_buf_ptr;
 		c = copy_input_buf[input_buf_ptr++];
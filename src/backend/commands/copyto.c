@@ -139,6 +139,8 @@ static void CopyToBinaryEnd(CopyToState cstate);
 static void SendCopyBegin(CopyToState cstate);
 static void SendCopyEnd(CopyToState cstate);
 static void CopySendData(CopyToState cstate, const void *databuf, int datasize);
+static void CopySendBinaryData(CopyToState cstate, const char *databuf,
+							   int datasize);
 static void CopySendString(CopyToState cstate, const char *str);
 static void CopySendChar(CopyToState cstate, char c);
 static void CopySendEndOfRow(CopyToState cstate);
@@ -370,8 +372,8 @@ CopyToBinaryOneRow(CopyToState cstate, TupleTableSlot *slot)
 			outputbytes = SendFunctionCall(&out_functions[attnum - 1],
 										   value);
 			CopySendInt32(cstate, VARSIZE(outputbytes) - VARHDRSZ);
-			CopySendData(cstate, VARDATA(outputbytes),
-						 VARSIZE(outputbytes) - VARHDRSZ);
+			CopySendBinaryData(cstate, VARDATA(outputbytes),
+							   VARSIZE(outputbytes) - VARHDRSZ);
 		}
 	}
 
@@ -446,6 +448,45 @@ CopySendChar(CopyToState cstate, char c)
 	appendStringInfoCharMacro(cstate->fe_msgbuf, c);
 }
 
+/*
+ * Minimum payload size for which CopySendBinaryData bypasses fe_msgbuf.
+ * Should comfortably exceed the libpq send buffer so that pqcomm's own
+ * write-through path applies to the resulting message as well.
+ */
+#define COPY_DIRECT_SEND_THRESHOLD	(64 * 1024)
+
+/*
+ * CopySendBinaryData sends the payload of one binary-format attribute.
+ *
+ * CopyData message boundaries carry no meaning in the COPY subprotocol, so
+ * when the destination is the frontend a large payload can be pushed through
+ * as its own message rather than accumulated in fe_msgbuf.  That spares us
+ * enlarging fe_msgbuf and copying big detoasted values an extra time; small
+ * values are cheaper to batch up in fe_msgbuf as usual.
+ */
+static void
+CopySendBinaryData(CopyToState cstate, const char *databuf, int datasize)
+{
+	if (cstate->copy_dest == COPY_FRONTEND &&
+		datasize >= COPY_DIRECT_SEND_THRESHOLD)
+	{
+		StringInfo	fe_msgbuf = cstate->fe_msgbuf;
+
+		/* Dump what has accumulated so far, to preserve output order */
+		if (fe_msgbuf->len > 0)
+		{
+			(void) pq_putmessage(PqMsg_CopyData, fe_msgbuf->data, fe_msgbuf->len);
+			cstate->bytes_processed += fe_msgbuf->len;
+			resetStringInfo(fe_msgbuf);
+		}
+
+		(void) pq_putmessage(PqMsg_CopyData, databuf, datasize);
+		cstate->bytes_processed += datasize;
+	}
+	else
+		CopySendData(cstate, databuf, datasize);
+}
+
 static void
 CopySendEndOfRow(CopyToState cstate)
 {
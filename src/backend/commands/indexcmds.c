@@ -3562,6 +3562,16 @@ ReindexMultipleInternal(const ReindexStmt *stmt, const List *relids, const Reind
  * concurrent build.  Temporary relations are not subject to concurrent
  * concerns, so there's no need for the more complicated concurrent build,
  * anyway, and a non-concurrent reindex is more efficient.
+ *
+ * The rebuild always scans the heap, even though the old index nominally
+ * contains every entry the new one needs, and feeding the old btree's leaf
+ * level (already in key order) straight into nbtsort.c would skip both the
+ * heap pass and the sort.  That shortcut doesn't survive concurrency: a
+ * leaf-level walk has no defense against concurrent page splits moving
+ * entries behind the scan the way the heap scan's block-ordered pass does,
+ * and the old index is suspect bloat-wise precisely when we are rebuilding
+ * it.  A heap scan also lets the new index shed dead entries for free,
+ * which is usually the point of the exercise.
  */
 static bool
 ReindexRelationConcurrently(const ReindexStmt *stmt, Oid relationOid, const ReindexParams *params)
@@ -840,36 +840,46 @@ refresh_by_match_merge(Oid matviewOid, Oid tempOid, Oid relowner,
 	 * must keep it around because its type is referenced from the diff table.
 	 */
 
-	/* Analyze the diff table. */
-	resetStringInfo(&querybuf);
-	appendStringInfo(&querybuf, "ANALYZE %s", diffname);
-	if (SPI_exec(querybuf.data, 0) != SPI_OK_UTILITY)
-		elog(ERROR, "SPI_exec failed: %s", querybuf.data);
-
-	OpenMatViewIncrementalMaintenance();
-
-	/* Deletes must come before inserts; do them first. */
-	resetStringInfo(&querybuf);
-	appendStringInfo(&querybuf,
-					 "DELETE FROM %s mv WHERE ctid OPERATOR(pg_catalog.=) ANY "
-					 "(SELECT diff.tid FROM %s diff "
-					 "WHERE diff.tid IS NOT NULL "
-					 "AND diff.newdata IS NULL)",
-					 matviewname, diffname);
-	if (SPI_exec(querybuf.data, 0) != SPI_OK_DELETE)
-		elog(ERROR, "SPI_exec failed: %s", querybuf.data);
-
-	/* Inserts go last. */
-	resetStringInfo(&querybuf);
-	appendStringInfo(&querybuf,
-					 "INSERT INTO %s SELECT (diff.newdata).* "
-					 "FROM %s diff WHERE tid IS NULL",
-					 matviewname, diffname);
-	if (SPI_exec(querybuf.data, 0) != SPI_OK_INSERT)
-		elog(ERROR, "SPI_exec failed: %s", querybuf.data);
+	/*
+	 * If the diff came out empty, the new contents are identical to the old
+	 * and there is nothing to apply, so skip straight to cleanup.  Periodic
+	 * refreshes of matviews whose base data seldom changes hit this case
+	 * often.
+	 */
+	if (SPI_processed != 0)
+	{
+		/* Analyze the diff table. */
+		resetStringInfo(&querybuf);
+		appendStringInfo(&querybuf, "ANALYZE %s", diffname);
+		if (SPI_exec(querybuf.data, 0) != SPI_OK_UTILITY)
+			elog(ERROR, "SPI_exec failed: %s", querybuf.data);
+
+		OpenMatViewIncrementalMaintenance();
+
+		/* Deletes must come before inserts; do them first. */
+		resetStringInfo(&querybuf);
+		appendStringInfo(&querybuf,
+						 "DELETE FROM %s mv WHERE ctid OPERATOR(pg_catalog.=) ANY "
+						 "(SELECT diff.tid FROM %s diff "
+						 "WHERE diff.tid IS NOT NULL "
+						 "AND diff.newdata IS NULL)",
+						 matviewname, diffname);
+		if (SPI_exec(querybuf.data, 0) != SPI_OK_DELETE)
+			elog(ERROR, "SPI_exec failed: %s", querybuf.data);
+
+		/* Inserts go last. */
+		resetStringInfo(&querybuf);
+		appendStringInfo(&querybuf,
+						 "INSERT INTO %s SELECT (diff.newdata).* "
+						 "FROM %s diff WHERE tid IS NULL",
+						 matviewname, diffname);
+		if (SPI_exec(querybuf.data, 0) != SPI_OK_INSERT)
+			elog(ERROR, "SPI_exec failed: %s", querybuf.data);
+
+		/* We're done maintaining the materialized view. */
+		CloseMatViewIncrementalMaintenance();
+	}
 
-	/* We're done maintaining the materialized view. */
-	CloseMatViewIncrementalMaintenance();
 	table_close(tempRel, NoLock);
 	table_close(matviewRel, NoLock);
 
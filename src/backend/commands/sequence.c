@@ -55,6 +55,19 @@
  * We don't want to log each fetching of a value from a sequence,
  * so we pre-log a few fetches in advance. In the event of
  * crash we can lose (skip over) as many values as we pre-logged.
+ *
+ * When many backends hammer one sequence, the serialization point is the
+ * exclusive lock on the sequence's buffer page, held for a few arithmetic
+ * operations and, once per SEQ_LOG_VALS fetches, a WAL record.  Moving the
+ * counter into a plain shared-memory atomic would shave the lock but
+ * recreate the same WAL-batching logic around the fetch-add, and it loses
+ * the properties the buffer path gives for free: crash consistency via
+ * redo of the page, and a home for per-sequence state that survives when
+ * no backend has it open.  The supported way to take a hot sequence off
+ * the page entirely is the CACHE clause, which hands each backend a
+ * private range; its size is a user-visible semantics choice (bigger
+ * caches mean bigger gaps and more out-of-order values), so we don't
+ * auto-tune it behind the user's back.
  */
 #define SEQ_LOG_VALS	32
 
@@ -4708,6 +4708,17 @@ afterTriggerMarkEvents(AfterTriggerEventList *events,
  *
  *	Returns true if no unfired events remain in the list (this allows us
  *	to avoid repeating afterTriggerMarkEvents).
+ *
+ *	Each row-level event is deliberately fired as its own function call:
+ *	the trigger API hands the function one OLD/NEW pair at a time, and
+ *	collapsing N events into one call would be a different API, not an
+ *	optimization of this one.  Callers wanting one invocation per batch
+ *	of rows already have that API — statement-level triggers with
+ *	transition tables, which accumulate the affected rows into
+ *	tuplestores and fire once.  Running queued events in a background
+ *	worker after commit is likewise off the table: AFTER triggers run
+ *	inside the queueing transaction by definition (they can see its
+ *	uncommitted work, and their errors must abort it).
  */
 static bool
 afterTriggerInvokeEvents(AfterTriggerEventList *events,
@@ -165,6 +165,7 @@ ExecVacuum(ParseState *pstate, VacuumStmt *vacstmt, bool isTopLevel)
 	BufferAccessStrategy bstrategy = NULL;
 	bool		verbose = false;
 	bool		skip_locked = false;
+	bool		skip_unchanged = false;
 	bool		analyze = false;
 	bool		freeze = false;
 	bool		full = false;
@@ -203,6 +204,8 @@ ExecVacuum(ParseState *pstate, VacuumStmt *vacstmt, bool isTopLevel)
 			verbose = defGetBoolean(opt);
 		else if (strcmp(opt->defname, "skip_locked") == 0)
 			skip_locked = defGetBoolean(opt);
+		else if (strcmp(opt->defname, "skip_unchanged") == 0)
+			skip_unchanged = defGetBoolean(opt);
 		else if (strcmp(opt->defname, "buffer_usage_limit") == 0)
 		{
 			const char *hintmsg;
@@ -303,6 +306,7 @@ ExecVacuum(ParseState *pstate, VacuumStmt *vacstmt, bool isTopLevel)
 		(vacstmt->is_vacuumcmd ? VACOPT_VACUUM : VACOPT_ANALYZE) |
 		(verbose ? VACOPT_VERBOSE : 0) |
 		(skip_locked ? VACOPT_SKIP_LOCKED : 0) |
+		(skip_unchanged ? VACOPT_SKIP_UNCHANGED : 0) |
 		(analyze ? VACOPT_ANALYZE : 0) |
 		(freeze ? VACOPT_FREEZE : 0) |
 		(full ? VACOPT_FULL : 0) |
@@ -333,6 +337,13 @@ ExecVacuum(ParseState *pstate, VacuumStmt *vacstmt, bool isTopLevel)
 				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
 				 errmsg("BUFFER_USAGE_LIMIT cannot be specified for VACUUM FULL")));
 
+	/* SKIP_UNCHANGED only affects the ANALYZE phase, so insist on one */
+	if ((params.options & VACOPT_SKIP_UNCHANGED) &&
+		!(params.options & VACOPT_ANALYZE))
+		ereport(ERROR,
+				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+				 errmsg("ANALYZE option must be specified when SKIP_UNCHANGED is provided")));
+
 	/*
 	 * Make sure VACOPT_ANALYZE is specified if any column lists are present.
 	 */
@@ -1584,6 +1595,66 @@ vac_update_relstats(Relation relation,
 }
 
 
+/*
+ *	vac_update_resume_point() -- save or clear aggressive VACUUM progress
+ *
+ *		Record in the relation's pg_class entry that an aggressive VACUUM has
+ *		fully processed all blocks below resume_block, and that resume_xid and
+ *		resume_mxid bound the oldest unfrozen XID/MXID left behind on those
+ *		blocks.  A later aggressive VACUUM of the same relation can pick up
+ *		the scan at resume_block instead of block zero, clamping its final
+ *		relfrozenxid/relminmxid with the saved values.  Passing
+ *		resume_block = 0 clears any saved progress.
+ *
+ *		Like vac_update_relstats, we overwrite the pg_class tuple in place.
+ *		The saved values are throwaway hints, so losing an update (or having
+ *		it survive an aborting transaction) is acceptable.
+ */
+void
+vac_update_resume_point(Relation relation, BlockNumber resume_block,
+						TransactionId resume_xid, MultiXactId resume_mxid)
+{
+	Oid			relid = RelationGetRelid(relation);
+	Relation	rd;
+	ScanKeyData key[1];
+	HeapTuple	ctup;
+	void	   *inplace_state;
+	Form_pg_class pgcform;
+
+	/* A cleared resume point must not carry XID bounds, and vice versa */
+	Assert((resume_block == 0) == !TransactionIdIsValid(resume_xid));
+	Assert((resume_block == 0) == !MultiXactIdIsValid(resume_mxid));
+
+	rd = table_open(RelationRelationId, RowExclusiveLock);
+
+	/* Fetch a copy of the tuple to scribble on */
+	ScanKeyInit(&key[0],
+				Anum_pg_class_oid,
+				BTEqualStrategyNumber, F_OIDEQ,
+				ObjectIdGetDatum(relid));
+	systable_inplace_update_begin(rd, ClassOidIndexId, true,
+								  NULL, 1, key, &ctup, &inplace_state);
+	if (!HeapTupleIsValid(ctup))
+		elog(ERROR, "pg_class entry for relid %u vanished during vacuuming",
+			 relid);
+	pgcform = (Form_pg_class) GETSTRUCT(ctup);
+
+	if (pgcform->relvacresumeblock != (int32) resume_block ||
+		pgcform->relvacresumexid != resume_xid ||
+		pgcform->relvacresumemxid != resume_mxid)
+	{
+		pgcform->relvacresumeblock = (int32) resume_block;
+		pgcform->relvacresumexid = resume_xid;
+		pgcform->relvacresumemxid = resume_mxid;
+		systable_inplace_update_finish(inplace_state, ctup);
+	}
+	else
+		systable_inplace_update_cancel(inplace_state);
+
+	table_close(rd, RowExclusiveLock);
+}
+
+
 /*
  *	vac_update_datfrozenxid() -- update pg_database.datfrozenxid for our DB
  *
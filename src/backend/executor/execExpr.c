@@ -18,6 +18,16 @@
  *	"Expression Trees and ExprState nodes", "Expression Initialization",
  *	and "Expression Evaluation" sections.
  *
+ *	Compilation is deliberately not memoized across structurally identical
+ *	expression trees (as recur across the partitions of one statement, say).
+ *	A compiled step array is not a pure function of the tree: steps embed
+ *	pointers to per-instance mutable state — FunctionCallInfo buffers whose
+ *	flinfo->fn_extra caches grow at runtime, result slots, per-step
+ *	ExprContext references, and parent PlanState linkage — so "clone and fix
+ *	up attnums" would silently share state that must be private.  Anyone
+ *	revisiting this should start by segregating those step fields from the
+ *	immutable program text; until then, each ExprState is built afresh.
+ *
  *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -2278,6 +2278,70 @@ out_error:
 	return (Datum) 0;
 }
 
+/*
+ * ExecQualBatch
+ *		Evaluate a qual prepared with ExecInitQual over a batch of input
+ *		slots, storing one boolean result per slot into *results.
+ *
+ * This is the batch-oriented counterpart of ExecQual().  Evaluation still
+ * goes through the scalar interpreter (or JITed code) per row, but the
+ * evalfunc indirection is resolved once for the whole batch and the
+ * per-tuple memory context is reset in one tight loop, which amortizes the
+ * per-call dispatch overhead that dominates qual-heavy scans.  Callers must
+ * arrange for econtext->ecxt_scantuple to be irrelevant or pass scan slots
+ * here; each slot is installed as ecxt_scantuple before its evaluation.
+ *
+ * Returns the number of slots that passed the qual.
+ */
+int
+ExecQualBatch(ExprState *state, ExprContext *econtext,
+			  TupleTableSlot **slots, int nslots, bool *results)
+{
+	ExprStateEvalFunc evalfunc;
+	int			npassed = 0;
+
+	/* short-circuit (here and in ExecInitQual) for empty restriction list */
+	if (state == NULL)
+	{
+		memset(results, true, nslots);
+		return nslots;
+	}
+
+	/* verify that expression was compiled using ExecInitQual */
+	Assert(state->flags & EEO_FLAG_IS_QUAL);
+
+	/*
+	 * Run the first row through the normal path, so that one-time checks
+	 * (ExecInterpExprStillValid) are performed and state->evalfunc settles
+	 * on the real evaluation function for the remainder of the batch.
+	 */
+	for (int i = 0; i < nslots; i++)
+	{
+		Datum		ret;
+		bool		isnull;
+
+		econtext->ecxt_scantuple = slots[i];
+
+		if (i == 0)
+			ret = ExecEvalExpr(state, econtext, &isnull);
+		else
+		{
+			evalfunc = state->evalfunc;
+			ret = evalfunc(state, econtext, &isnull);
+		}
+
+		/* EEOP_QUAL should never return NULL */
+		Assert(!isnull);
+
+		results[i] = DatumGetBool(ret);
+		npassed += (int) results[i];
+
+		MemoryContextReset(econtext->ecxt_per_tuple_memory);
+	}
+
+	return npassed;
+}
+
 /*
  * Expression evaluation callback that performs extra checks before executing
  * the expression. Declared extern so other methods of execution can use it
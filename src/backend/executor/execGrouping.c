@@ -429,6 +429,21 @@ TupleHashTableHash(TupleHashTable hashtable, TupleTableSlot *slot)
 	return hash;
 }
 
+/*
+ * Prefetch the hash table bucket that a tuple hashing to the given value
+ * will probe first.  Callers that know several upcoming probes (e.g. one
+ * per grouping set, or a batch of input tuples) can issue the prefetches
+ * up front so the cache misses overlap instead of serializing; the bucket
+ * index computation mirrors simplehash's initial-bucket choice.
+ */
+void
+PrefetchTupleHashBucket(TupleHashTable hashtable, uint32 hash)
+{
+	tuplehash_hash *tb = hashtable->hashtab;
+
+	pg_prefetch_mem(&tb->data[hash & tb->sizemask]);
+}
+
 /*
  * A variant of LookupTupleHashEntry for callers that have already computed
  * the hash value.
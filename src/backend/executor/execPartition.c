@@ -1392,6 +1392,16 @@ FormPartitionKeyDatum(PartitionDispatch pd,
  * indexes match.  For the NULL partition, this is just so cheap, there's no
  * sense in caching.
  *
+ * HASH partitioning likewise gets no cache, nor would batching help it:
+ * the lookup is already a hash computation plus a direct index into
+ * boundinfo, and the hash must be computed per row regardless, so there is
+ * no search to amortize across a batch.  Routing a vector of rows and
+ * sorting them by destination has also been proposed for the other
+ * strategies, but runs of same-destination rows are exactly what the cache
+ * above exploits without the sort, and callers that benefit from grouping
+ * rows per destination (such as COPY's multi-insert buffering) already
+ * regroup downstream of this function.
+ *
  * Return value is index of the partition (>= 0 and < partdesc->nparts) if one
  * found or -1 if none found.
  */
@@ -1753,6 +1753,40 @@ ExecStoreVirtualTuple(TupleTableSlot *slot)
 	return slot;
 }
 
+/* --------------------------------
+ *		ExecDeformBatchColumnar
+ *			Deform a batch of slots into column-major Datum/isnull arrays.
+ *
+ * For each of the first natts attributes, values[att] and isnull[att] must
+ * point to caller-provided arrays with room for nslots entries; on return,
+ * values[att][row] / isnull[att][row] hold the attribute value of slot row.
+ * Each slot is deformed once via slot_getsomeattrs(), so the per-row
+ * deforming cost is the same as for row-at-a-time access, but consumers
+ * such as aggregate transition loops can then iterate over contiguous
+ * per-attribute arrays instead of pointer-chasing individual slots.
+ *
+ * The returned Datums are owned by the slots; callers must not assume they
+ * survive clearing or re-storing the source slots.
+ * --------------------------------
+ */
+void
+ExecDeformBatchColumnar(TupleTableSlot **slots, int nslots, int natts,
+						Datum **values, bool **isnull)
+{
+	for (int row = 0; row < nslots; row++)
+	{
+		TupleTableSlot *slot = slots[row];
+
+		slot_getsomeattrs(slot, natts);
+
+		for (int att = 0; att < natts; att++)
+		{
+			values[att][row] = slot->tts_values[att];
+			isnull[att][row] = slot->tts_isnull[att];
+		}
+	}
+}
+
 /* --------------------------------
  *		ExecStoreAllNullTuple
  *			Set up the slot to contain a null in every column.
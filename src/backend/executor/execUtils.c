@@ -253,14 +253,19 @@ CreateExprContextInternal(EState *estate, Size minContextSize,
 	econtext->ecxt_per_query_memory = estate->es_query_cxt;
 
 	/*
-	 * Create working memory for expression evaluation in this context.
+	 * Create working memory for expression evaluation in this context.  Use
+	 * a generation context: per-tuple memory is reset wholesale after each
+	 * tuple, so the allocation-order lifetime it assumes holds, and its
+	 * simple bump-style allocation avoids aset's freelist management.  (A
+	 * bump context proper is out of the question, since functions routinely
+	 * pfree detoasted copies of their arguments here.)
 	 */
 	econtext->ecxt_per_tuple_memory =
-		AllocSetContextCreate(estate->es_query_cxt,
-							  "ExprContext",
-							  minContextSize,
-							  initBlockSize,
-							  maxBlockSize);
+		GenerationContextCreate(estate->es_query_cxt,
+								"ExprContext",
+								minContextSize,
+								initBlockSize,
+								maxBlockSize);
 
 	econtext->ecxt_param_exec_vals = estate->es_param_exec_vals;
 	econtext->ecxt_param_list_info = estate->es_param_list_info;
@@ -372,9 +377,9 @@ CreateStandaloneExprContext(void)
 	 * Create working memory for expression evaluation in this context.
 	 */
 	econtext->ecxt_per_tuple_memory =
-		AllocSetContextCreate(CurrentMemoryContext,
-							  "ExprContext",
-							  ALLOCSET_DEFAULT_SIZES);
+		GenerationContextCreate(CurrentMemoryContext,
+								"ExprContext",
+								ALLOCSET_DEFAULT_SIZES);
 
 	econtext->ecxt_param_exec_vals = NULL;
 	econtext->ecxt_param_list_info = NULL;
@@ -1455,7 +1455,15 @@ find_cols_walker(Node *node, FindColsContext *context)
  * for each entry.
  *
  * We have a separate hashtable and associated perhash data structure for each
- * grouping set for which we're doing hashing.
+ * grouping set for which we're doing hashing.  All such tables are filled
+ * from a single pass over the input (see lookup_hash_entries), so hashable
+ * grouping sets never force the input to be re-read or re-sorted; sort-based
+ * phases survive only for sets the planner judged too large or unhashable
+ * (see consider_groupingsets_paths), and AGG_MIXED populates the hash tables
+ * during the first sorted phase anyway.  The memory limit is split evenly
+ * across the tables below; a priority split favoring the sets expected to
+ * have fewer groups would only change which tables spill first, since the
+ * spill machinery already handles each table independently.
  *
  * The contents of the hash tables live in the aggstate's hash_tuplescxt
  * memory context (there is only one of these for all tables together, since
@@ -2183,8 +2191,29 @@ lookup_hash_entries(AggState *aggstate)
 {
 	AggStatePerGroup *pergroup = aggstate->hash_pergroup;
 	TupleTableSlot *outerslot = aggstate->tmpcontext->ecxt_outertuple;
+	bool		prehashed = (aggstate->num_hashes > 1);
 	int			setno;
 
+	/*
+	 * With multiple hash tables (grouping sets), hash the tuple against all
+	 * of them up front and prefetch each table's target bucket, so that the
+	 * probes in the loop below overlap their cache misses instead of taking
+	 * them one after another.  For the common single-table case the split
+	 * would buy nothing, so we keep the one-pass form.
+	 */
+	if (prehashed)
+	{
+		for (setno = 0; setno < aggstate->num_hashes; setno++)
+		{
+			AggStatePerHash perhash = &aggstate->perhash[setno];
+
+			prepare_hash_slot(perhash, outerslot, perhash->hashslot);
+			perhash->lookup_hash = TupleHashTableHash(perhash->hashtable,
+													  perhash->hashslot);
+			PrefetchTupleHashBucket(perhash->hashtable, perhash->lookup_hash);
+		}
+	}
+
 	for (setno = 0; setno < aggstate->num_hashes; setno++)
 	{
 		AggStatePerHash perhash = &aggstate->perhash[setno];
@@ -2199,12 +2228,22 @@ lookup_hash_entries(AggState *aggstate)
 		p_isnew = aggstate->hash_spill_mode ? NULL : &isnew;
 
 		select_current_set(aggstate, setno, true);
-		prepare_hash_slot(perhash,
-						  outerslot,
-						  hashslot);
 
-		entry = LookupTupleHashEntry(hashtable, hashslot,
-									 p_isnew, &hash);
+		if (prehashed)
+		{
+			hash = perhash->lookup_hash;
+			entry = LookupTupleHashEntryHash(hashtable, hashslot,
+											 p_isnew, hash);
+		}
+		else
+		{
+			prepare_hash_slot(perhash,
+							  outerslot,
+							  hashslot);
+
+			entry = LookupTupleHashEntry(hashtable, hashslot,
+										 p_isnew, &hash);
+		}
 
 		if (entry != NULL)
 		{
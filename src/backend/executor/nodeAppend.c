@@ -1040,6 +1040,20 @@ ExecAppendAsyncEventWait(AppendState *node)
 	/* We should never be called when there are no valid async subplans. */
 	Assert(node->as_nasyncremain > 0);
 
+	/*
+	 * If no async subplan is awaiting a callback, none of them could
+	 * register an event below, so don't bother building a WaitEventSet just
+	 * to tear it down again; that costs a kernel object per call.
+	 */
+	i = -1;
+	while ((i = bms_next_member(node->as_asyncplans, i)) >= 0)
+	{
+		if (node->as_asyncrequests[i]->callback_pending)
+			break;
+	}
+	if (i < 0)
+		return;
+
 	Assert(node->as_eventset == NULL);
 	node->as_eventset = CreateWaitEventSet(CurrentResourceOwner, nevents);
 	AddWaitEventToSet(node->as_eventset, WL_EXIT_ON_PM_DEATH, PGINVALID_SOCKET,
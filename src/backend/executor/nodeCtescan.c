@@ -3,6 +3,23 @@
  * nodeCtescan.c
  *	  routines to handle CteScan nodes.
  *
+ * A materialized CTE is computed once per backend into a plain tuplestore
+ * owned by the CteState of the leading CteScan; other CteScans on the same
+ * CTE share that tuplestore via their own read pointers.  Because the
+ * tuplestore is backend-private, CteScan paths are never marked
+ * parallel-safe: rather than workers each recomputing the CTE, the planner
+ * simply keeps every reference to it out of parallel plans, which often
+ * suppresses parallelism for the whole query level.
+ *
+ * XXX Computing the CTE once into a SharedTuplestore and letting workers
+ * read it in parallel would lift that restriction, but it's more than an
+ * executor change: sharedtuplestore.c readers consume a partition-style
+ * scan (each tuple goes to one reader) and would need a broadcast-read
+ * mode with per-reader positions; someone must win the right to fill the
+ * store while the others wait on a barrier; rescans and mark/restore need
+ * answers; and the planner would have to cost and mark such scans
+ * parallel-safe.  Until then, plans referencing a CTE stay serial.
+ *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
@@ -34,6 +34,7 @@
 #include "executor/hashjoin.h"
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
+#include "lib/bloomfilter.h"
 #include "miscadmin.h"
 #include "port/pg_bitutils.h"
 #include "utils/lsyscache.h"
@@ -506,6 +507,7 @@ ExecHashTableCreate(HashState *state)
 	hashtable->nbatch_original = nbatch;
 	hashtable->nbatch_outstart = nbatch;
 	hashtable->growEnabled = true;
+	hashtable->bloomfilter = NULL;
 	hashtable->totalTuples = 0;
 	hashtable->partialTuples = 0;
 	hashtable->skewTuples = 0;
@@ -1171,14 +1173,20 @@ ExecHashIncreaseNumBatches(HashJoinTable hashtable)
 #endif
 
 	/*
-	 * If we dumped out either all or none of the tuples in the table, disable
-	 * further expansion of nbatch.  This situation implies that we have
-	 * enough tuples of identical hashvalues to overflow spaceAllowed.
-	 * Increasing nbatch will not fix it since there's no way to subdivide the
-	 * group any more finely. We have to just gut it out and hope the server
-	 * has enough RAM.
+	 * If we dumped out all, none, or nearly none of the tuples in the table,
+	 * disable further expansion of nbatch.  This situation implies that we
+	 * have enough tuples of identical (or nearly identical) hashvalues to
+	 * overflow spaceAllowed.  Increasing nbatch will not fix it since
+	 * there's no way to subdivide the group any more finely; each doubling
+	 * would just double the number of batch files while freeing almost no
+	 * memory. We have to just gut it out and hope the server has enough RAM.
+	 *
+	 * The threshold is deliberately loose (5%): when a split is this
+	 * lopsided, the skewed value's tuples dominate memory use, and repeated
+	 * doubling has historically turned modest misestimates into spill
+	 * storms with tens of thousands of batch files.
 	 */
-	if (nfreed == 0 || nfreed == ninmemory)
+	if (nfreed <= ninmemory / 20 || nfreed >= ninmemory - ninmemory / 20)
 	{
 		hashtable->growEnabled = false;
 #ifdef HJDEBUG
@@ -1754,6 +1762,15 @@ ExecHashTableInsert(HashJoinTable hashtable,
 	int			bucketno;
 	int			batchno;
 
+	/*
+	 * Remember the hash value in the Bloom filter, if we're keeping one.
+	 * (Tuples reloaded from an inner batch file get added a second time,
+	 * which is harmless.)
+	 */
+	if (hashtable->bloomfilter)
+		bloom_add_element(hashtable->bloomfilter,
+						  (unsigned char *) &hashvalue, sizeof(uint32));
+
 	ExecHashGetBucketAndBatch(hashtable, hashvalue,
 							  &bucketno, &batchno);
 
@@ -2607,6 +2624,11 @@ ExecHashSkewTableInsert(HashJoinTable hashtable,
 	HashJoinTuple hashTuple;
 	int			hashTupleSize;
 
+	/* Skew tuples must enter the Bloom filter too */
+	if (hashtable->bloomfilter)
+		bloom_add_element(hashtable->bloomfilter,
+						  (unsigned char *) &hashvalue, sizeof(uint32));
+
 	/* Create the HashJoinTuple */
 	hashTupleSize = HJTUPLE_OVERHEAD + tuple->t_len;
 	hashTuple = (HashJoinTuple) MemoryContextAlloc(hashtable->batchCxt,
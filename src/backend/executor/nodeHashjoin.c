@@ -157,6 +157,17 @@
  * will see that it's too late to participate or access the relevant shared
  * memory objects.
  *
+ * The shared-table machinery is sometimes suggested as a way to share one
+ * build between structurally identical Hash nodes in different branches of
+ * the same plan (e.g. the same join repeated under a UNION ALL).  It is not
+ * suited to that: the barriers above coordinate workers that are all
+ * executing the *same* plan node concurrently, whereas sibling nodes run at
+ * unrelated times, each owns its hash table's lifetime (rescans, shutdown),
+ * and instrumentation is per-node.  Deduplicating identical subplans is a
+ * planner-level common-subexpression problem; until the planner does that,
+ * queries can get the sharing explicitly by factoring the join into a
+ * MATERIALIZED common table expression.
+ *
  *-------------------------------------------------------------------------
  */
 
@@ -168,6 +179,7 @@
 #include "executor/hashjoin.h"
 #include "executor/nodeHash.h"
 #include "executor/nodeHashjoin.h"
+#include "lib/bloomfilter.h"
 #include "miscadmin.h"
 #include "utils/lsyscache.h"
 #include "utils/sharedtuplestore.h"
@@ -335,6 +347,25 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 				hashtable = ExecHashTableCreate(hashNode);
 				node->hj_HashTable = hashtable;
 
+				/*
+				 * For a serial multi-batch join that doesn't emit unmatched
+				 * outer tuples, keep a Bloom filter over the inner hash
+				 * values as a side effect of loading the hash table.  Outer
+				 * tuples the filter rules out can then be discarded as soon
+				 * as they're hashed, instead of being written to an outer
+				 * batch file only to be reread and rejected later.
+				 */
+				if (!parallel && !HJ_FILL_OUTER(node) && hashtable->nbatch > 1)
+				{
+					MemoryContext oldcxt;
+
+					oldcxt = MemoryContextSwitchTo(hashtable->hashCxt);
+					hashtable->bloomfilter =
+						bloom_create((int64) hashNode->ps.plan->plan_rows,
+									 work_mem, 0);
+					MemoryContextSwitchTo(oldcxt);
+				}
+
 				/*
 				 * Execute the Hash node, to build the hash table.  If using
 				 * Parallel Hash, then we'll try to help hashing unless we
@@ -460,6 +491,22 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 					continue;
 				}
 
+				/*
+				 * If the Bloom filter proves that no inner tuple can have
+				 * this hash value, discard the outer tuple right away.  A
+				 * filter is only installed for join types whose unmatched
+				 * outer tuples aren't emitted.
+				 */
+				if (hashtable->bloomfilter &&
+					bloom_lacks_element(hashtable->bloomfilter,
+										(unsigned char *) &hashvalue,
+										sizeof(uint32)))
+				{
+					Assert(!HJ_FILL_OUTER(node));
+					/* Loop around, staying in HJ_NEED_NEW_OUTER state */
+					continue;
+				}
+
 				econtext->ecxt_outertuple = outerTupleSlot;
 				node->hj_MatchedOuter = false;
 
@@ -102,6 +102,9 @@ IndexOnlyNext(IndexOnlyScanState *node)
 		/* Set it up for index-only scan */
 		node->ioss_ScanDesc->xs_want_itup = true;
 		node->ioss_VMBuffer = InvalidBuffer;
+		node->ioss_VisBlockNumber = InvalidBlockNumber;
+		node->ioss_VisBatchId = 0;
+		node->ioss_VisAllVisible = false;
 
 		/*
 		 * If no run-time keys to calculate or they are ready, go ahead and
@@ -120,6 +123,8 @@ IndexOnlyNext(IndexOnlyScanState *node)
 	 */
 	while ((tid = index_getnext_tid(scandesc, direction)) != NULL)
 	{
+		BlockNumber blkno = ItemPointerGetBlockNumber(tid);
+		bool		all_visible;
 		bool		tuple_from_heap = false;
 
 		CHECK_FOR_INTERRUPTS();
@@ -157,10 +162,33 @@ IndexOnlyNext(IndexOnlyScanState *node)
 		 *
 		 * It's worth going through this complexity to avoid needing to lock
 		 * the VM buffer, which could cause significant contention.
+		 *
+		 * Index tuples belonging to a single AM batch (one btree leaf page)
+		 * were all captured under the same index page lock, so the insert
+		 * serialization argument above holds batch-wide once we've consulted
+		 * the visibility map for a given heap block: a concurrently inserted
+		 * TID on that block can only be part of this batch if its VM bit was
+		 * cleared before the batch was read.  Hence, within one batch, reuse
+		 * the previous block's result rather than consulting the map again
+		 * for every TID.  A cached result must never survive into a later
+		 * batch, though, so it is tagged with xs_batch_id; AMs that don't
+		 * maintain that counter leave it at zero and get a per-TID check as
+		 * before.
 		 */
-		if (!VM_ALL_VISIBLE(scandesc->heapRelation,
-							ItemPointerGetBlockNumber(tid),
-							&node->ioss_VMBuffer))
+		if (scandesc->xs_batch_id != 0 &&
+			scandesc->xs_batch_id == node->ioss_VisBatchId &&
+			blkno == node->ioss_VisBlockNumber)
+			all_visible = node->ioss_VisAllVisible;
+		else
+		{
+			all_visible = VM_ALL_VISIBLE(scandesc->heapRelation, blkno,
+										 &node->ioss_VMBuffer);
+			node->ioss_VisBatchId = scandesc->xs_batch_id;
+			node->ioss_VisBlockNumber = blkno;
+			node->ioss_VisAllVisible = all_visible;
+		}
+
+		if (!all_visible)
 		{
 			/*
 			 * Rats, we have to visit the heap to check visibility.
@@ -244,8 +272,7 @@ IndexOnlyNext(IndexOnlyScanState *node)
 		 * lock explicitly, as if we had.  For now we do that at page level.
 		 */
 		if (!tuple_from_heap)
-			PredicateLockPage(scandesc->heapRelation,
-							  ItemPointerGetBlockNumber(tid),
+			PredicateLockPage(scandesc->heapRelation, blkno,
 							  estate->es_snapshot);
 
 		return slot;
@@ -792,6 +819,9 @@ ExecIndexOnlyScanInitializeDSM(IndexOnlyScanState *node,
 								 piscan);
 	node->ioss_ScanDesc->xs_want_itup = true;
 	node->ioss_VMBuffer = InvalidBuffer;
+	node->ioss_VisBlockNumber = InvalidBlockNumber;
+	node->ioss_VisBatchId = 0;
+	node->ioss_VisAllVisible = false;
 
 	/*
 	 * If no run-time keys to calculate or they are ready, go ahead and pass
@@ -857,6 +887,9 @@ ExecIndexOnlyScanInitializeWorker(IndexOnlyScanState *node,
 								 node->ioss_NumOrderByKeys,
 								 piscan);
 	node->ioss_ScanDesc->xs_want_itup = true;
+	node->ioss_VisBlockNumber = InvalidBlockNumber;
+	node->ioss_VisBatchId = 0;
+	node->ioss_VisAllVisible = false;
 
 	/*
 	 * If no run-time keys to calculate or they are ready, go ahead and pass
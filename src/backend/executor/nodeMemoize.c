@@ -50,6 +50,18 @@
  * demanding, then that may allow us to start putting useful entries back into
  * the cache again.
  *
+ * The cache lives only as long as the executor state for the query; it is
+ * thrown away in ExecEndMemoize along with the rest of the plan state.  A
+ * cache which survived across executions, so that repeated runs of the same
+ * prepared statement could skip the inner scans entirely, has been suggested
+ * from time to time, but it cannot be done safely: the cached tuples are the
+ * inner side's output under one particular snapshot, and a later execution
+ * runs under a different snapshot which may see different rows.  There is no
+ * cheap way to detect that, either; relation cache invalidation messages are
+ * sent for DDL and similar operations, not for ordinary inserts, updates and
+ * deletes, so the absence of invalidations says nothing about whether the
+ * inner side's contents have changed.
+ *
  *
  * INTERFACE ROUTINES
  *		ExecMemoize			- lookup cache, exec subplan when not found
@@ -201,6 +201,8 @@ ExecInitMergeAppend(MergeAppend *node, EState *estate, int eflags)
 	 * initialize to show we have not run the subplans yet
 	 */
 	mergestate->ms_initialized = false;
+	mergestate->ms_runnerup = -1;
+	mergestate->ms_runlen = 0;
 
 	return mergestate;
 }
@@ -247,6 +249,8 @@ ExecMergeAppend(PlanState *pstate)
 				binaryheap_add_unordered(node->ms_heap, Int32GetDatum(i));
 		}
 		binaryheap_build(node->ms_heap);
+		node->ms_runnerup = -1;
+		node->ms_runlen = 0;
 		node->ms_initialized = true;
 	}
 	else
@@ -260,11 +264,61 @@ ExecMergeAppend(PlanState *pstate)
 		 * to not pull tuples until necessary.)
 		 */
 		i = DatumGetInt32(binaryheap_first(node->ms_heap));
+
+		/*
+		 * When the same subplan has been supplying the minimal tuple for a
+		 * few consecutive rows --- common when partition bounds line up with
+		 * the sort key, so that entire partitions sort one after another ---
+		 * it is worth identifying the runner-up subplan once, so that each
+		 * subsequent row needs just one comparison against it instead of a
+		 * heap siftdown.  The runner-up is the higher-priority of the root's
+		 * children, and stays valid as long as the heap isn't otherwise
+		 * modified, since only the leader's tuple changes.
+		 */
+		if (node->ms_runlen >= 2 && node->ms_runnerup < 0 &&
+			binaryheap_size(node->ms_heap) >= 2)
+		{
+			SlotNumber	runnerup;
+
+			runnerup = DatumGetInt32(binaryheap_get_node(node->ms_heap, 1));
+			if (binaryheap_size(node->ms_heap) >= 3 &&
+				heap_compare_slots(binaryheap_get_node(node->ms_heap, 2),
+								   Int32GetDatum(runnerup), node) > 0)
+				runnerup = DatumGetInt32(binaryheap_get_node(node->ms_heap, 2));
+			node->ms_runnerup = runnerup;
+		}
+
 		node->ms_slots[i] = ExecProcNode(node->mergeplans[i]);
 		if (!TupIsNull(node->ms_slots[i]))
-			binaryheap_replace_first(node->ms_heap, Int32GetDatum(i));
+		{
+			if (node->ms_runnerup >= 0 &&
+				heap_compare_slots(Int32GetDatum(i),
+								   Int32GetDatum(node->ms_runnerup),
+								   node) >= 0)
+			{
+				/*
+				 * The leader's new tuple still precedes every other
+				 * subplan's tuple, so the heap is already correct.
+				 */
+			}
+			else
+			{
+				binaryheap_replace_first(node->ms_heap, Int32GetDatum(i));
+				node->ms_runnerup = -1;
+			}
+		}
 		else
+		{
 			(void) binaryheap_remove_first(node->ms_heap);
+			node->ms_runnerup = -1;
+		}
+
+		/* Track how long the current leader has been winning. */
+		if (!binaryheap_empty(node->ms_heap) &&
+			DatumGetInt32(binaryheap_first(node->ms_heap)) == i)
+			node->ms_runlen++;
+		else
+			node->ms_runlen = 0;
 	}
 
 	if (binaryheap_empty(node->ms_heap))
@@ -78,6 +78,14 @@ typedef struct MTTargetRelLookup
 	int			relationIndex;	/* rel's index in resultRelInfo[] array */
 } MTTargetRelLookup;
 
+/*
+ * Number of tuples to accumulate before flushing a batched plain-table
+ * INSERT through table_multi_insert.  This matches the tuple limit COPY
+ * uses for its multi-inserts; buffered tuples are freed at each flush, so
+ * this also bounds the memory used.
+ */
+#define EXEC_INSERT_BATCH_SIZE	1000
+
 /*
  * Context struct for a ModifyTable operation, containing basic execution
  * state and some output variables populated by ExecUpdateAct() and
@@ -132,6 +140,12 @@ typedef struct UpdateContext
 } UpdateContext;
 
 
+static void ExecInsertBatchSlot(ModifyTableState *mtstate,
+								ResultRelInfo *resultRelInfo,
+								TupleTableSlot *slot,
+								TupleTableSlot *planSlot,
+								EState *estate,
+								bool canSetTag);
 static void ExecBatchInsert(ModifyTableState *mtstate,
 							ResultRelInfo *resultRelInfo,
 							TupleTableSlot **slots,
@@ -864,7 +878,6 @@ ExecInsert(ModifyTableContext *context,
 	ModifyTable *node = (ModifyTable *) mtstate->ps.plan;
 	OnConflictAction onconflict = node->onConflictAction;
 	PartitionTupleRouting *proute = mtstate->mt_partition_tuple_routing;
-	MemoryContext oldContext;
 
 	/*
 	 * If the input result relation is a partitioned table, find the leaf
@@ -941,88 +954,8 @@ ExecInsert(ModifyTableContext *context,
 		 */
 		if (resultRelInfo->ri_BatchSize > 1)
 		{
-			bool		flushed = false;
-
-			/*
-			 * When we've reached the desired batch size, perform the
-			 * insertion.
-			 */
-			if (resultRelInfo->ri_NumSlots == resultRelInfo->ri_BatchSize)
-			{
-				ExecBatchInsert(mtstate, resultRelInfo,
-								resultRelInfo->ri_Slots,
-								resultRelInfo->ri_PlanSlots,
-								resultRelInfo->ri_NumSlots,
+			ExecInsertBatchSlot(mtstate, resultRelInfo, slot, planSlot,
 								estate, canSetTag);
-				flushed = true;
-			}
-
-			oldContext = MemoryContextSwitchTo(estate->es_query_cxt);
-
-			if (resultRelInfo->ri_Slots == NULL)
-			{
-				resultRelInfo->ri_Slots = palloc(sizeof(TupleTableSlot *) *
-												 resultRelInfo->ri_BatchSize);
-				resultRelInfo->ri_PlanSlots = palloc(sizeof(TupleTableSlot *) *
-													 resultRelInfo->ri_BatchSize);
-			}
-
-			/*
-			 * Initialize the batch slots. We don't know how many slots will
-			 * be needed, so we initialize them as the batch grows, and we
-			 * keep them across batches. To mitigate an inefficiency in how
-			 * resource owner handles objects with many references (as with
-			 * many slots all referencing the same tuple descriptor) we copy
-			 * the appropriate tuple descriptor for each slot.
-			 */
-			if (resultRelInfo->ri_NumSlots >= resultRelInfo->ri_NumSlotsInitialized)
-			{
-				TupleDesc	tdesc = CreateTupleDescCopy(slot->tts_tupleDescriptor);
-				TupleDesc	plan_tdesc =
-					CreateTupleDescCopy(planSlot->tts_tupleDescriptor);
-
-				resultRelInfo->ri_Slots[resultRelInfo->ri_NumSlots] =
-					MakeSingleTupleTableSlot(tdesc, slot->tts_ops);
-
-				resultRelInfo->ri_PlanSlots[resultRelInfo->ri_NumSlots] =
-					MakeSingleTupleTableSlot(plan_tdesc, planSlot->tts_ops);
-
-				/* remember how many batch slots we initialized */
-				resultRelInfo->ri_NumSlotsInitialized++;
-			}
-
-			ExecCopySlot(resultRelInfo->ri_Slots[resultRelInfo->ri_NumSlots],
-						 slot);
-
-			ExecCopySlot(resultRelInfo->ri_PlanSlots[resultRelInfo->ri_NumSlots],
-						 planSlot);
-
-			/*
-			 * If these are the first tuples stored in the buffers, add the
-			 * target rel and the mtstate to the
-			 * es_insert_pending_result_relations and
-			 * es_insert_pending_modifytables lists respectively, except in
-			 * the case where flushing was done above, in which case they
-			 * would already have been added to the lists, so no need to do
-			 * this.
-			 */
-			if (resultRelInfo->ri_NumSlots == 0 && !flushed)
-			{
-				Assert(!list_member_ptr(estate->es_insert_pending_result_relations,
-										resultRelInfo));
-				estate->es_insert_pending_result_relations =
-					lappend(estate->es_insert_pending_result_relations,
-							resultRelInfo);
-				estate->es_insert_pending_modifytables =
-					lappend(estate->es_insert_pending_modifytables, mtstate);
-			}
-			Assert(list_member_ptr(estate->es_insert_pending_result_relations,
-								   resultRelInfo));
-
-			resultRelInfo->ri_NumSlots++;
-
-			MemoryContextSwitchTo(oldContext);
-
 			return NULL;
 		}
 
@@ -1228,6 +1161,18 @@ ExecInsert(ModifyTableContext *context,
 
 			/* Since there was no insertion conflict, we're done */
 		}
+		else if (resultRelInfo->ri_BatchSize > 1)
+		{
+			/*
+			 * Batching was enabled for this plain table at executor startup;
+			 * accumulate the tuple and insert the batch later, through
+			 * table_multi_insert.  Index entries and AFTER ROW triggers are
+			 * handled when the batch is flushed.
+			 */
+			ExecInsertBatchSlot(mtstate, resultRelInfo, slot, planSlot,
+								estate, canSetTag);
+			return NULL;
+		}
 		else
 		{
 			/* insert the tuple normally */
@@ -1355,12 +1300,114 @@ ExecInsert(ModifyTableContext *context,
 	return result;
 }
 
+/* ----------------------------------------------------------------
+ *		ExecInsertBatchSlot
+ *
+ *		Store a tuple (and the corresponding plan slot) into the batch
+ *		buffers of the given target relation, to be inserted later by
+ *		ExecBatchInsert.  If the buffers are full, flush them first.
+ *
+ *		The caller must have verified ri_BatchSize > 1, which implies
+ *		all the conditions checked when the batch size was chosen (no
+ *		RETURNING, no ON CONFLICT, and so on) hold for this relation.
+ * ----------------------------------------------------------------
+ */
+static void
+ExecInsertBatchSlot(ModifyTableState *mtstate,
+					ResultRelInfo *resultRelInfo,
+					TupleTableSlot *slot,
+					TupleTableSlot *planSlot,
+					EState *estate,
+					bool canSetTag)
+{
+	MemoryContext oldContext;
+	bool		flushed = false;
+
+	/*
+	 * When we've reached the desired batch size, perform the insertion.
+	 */
+	if (resultRelInfo->ri_NumSlots == resultRelInfo->ri_BatchSize)
+	{
+		ExecBatchInsert(mtstate, resultRelInfo,
+						resultRelInfo->ri_Slots,
+						resultRelInfo->ri_PlanSlots,
+						resultRelInfo->ri_NumSlots,
+						estate, canSetTag);
+		flushed = true;
+	}
+
+	oldContext = MemoryContextSwitchTo(estate->es_query_cxt);
+
+	if (resultRelInfo->ri_Slots == NULL)
+	{
+		resultRelInfo->ri_Slots = palloc(sizeof(TupleTableSlot *) *
+										 resultRelInfo->ri_BatchSize);
+		resultRelInfo->ri_PlanSlots = palloc(sizeof(TupleTableSlot *) *
+											 resultRelInfo->ri_BatchSize);
+	}
+
+	/*
+	 * Initialize the batch slots. We don't know how many slots will be
+	 * needed, so we initialize them as the batch grows, and we keep them
+	 * across batches. To mitigate an inefficiency in how resource owner
+	 * handles objects with many references (as with many slots all
+	 * referencing the same tuple descriptor) we copy the appropriate tuple
+	 * descriptor for each slot.
+	 */
+	if (resultRelInfo->ri_NumSlots >= resultRelInfo->ri_NumSlotsInitialized)
+	{
+		TupleDesc	tdesc = CreateTupleDescCopy(slot->tts_tupleDescriptor);
+		TupleDesc	plan_tdesc =
+			CreateTupleDescCopy(planSlot->tts_tupleDescriptor);
+
+		resultRelInfo->ri_Slots[resultRelInfo->ri_NumSlots] =
+			MakeSingleTupleTableSlot(tdesc, slot->tts_ops);
+
+		resultRelInfo->ri_PlanSlots[resultRelInfo->ri_NumSlots] =
+			MakeSingleTupleTableSlot(plan_tdesc, planSlot->tts_ops);
+
+		/* remember how many batch slots we initialized */
+		resultRelInfo->ri_NumSlotsInitialized++;
+	}
+
+	ExecCopySlot(resultRelInfo->ri_Slots[resultRelInfo->ri_NumSlots],
+				 slot);
+
+	ExecCopySlot(resultRelInfo->ri_PlanSlots[resultRelInfo->ri_NumSlots],
+				 planSlot);
+
+	/*
+	 * If these are the first tuples stored in the buffers, add the target rel
+	 * and the mtstate to the es_insert_pending_result_relations and
+	 * es_insert_pending_modifytables lists respectively, except in the case
+	 * where flushing was done above, in which case they would already have
+	 * been added to the lists, so no need to do this.
+	 */
+	if (resultRelInfo->ri_NumSlots == 0 && !flushed)
+	{
+		Assert(!list_member_ptr(estate->es_insert_pending_result_relations,
+								resultRelInfo));
+		estate->es_insert_pending_result_relations =
+			lappend(estate->es_insert_pending_result_relations,
+					resultRelInfo);
+		estate->es_insert_pending_modifytables =
+			lappend(estate->es_insert_pending_modifytables, mtstate);
+	}
+	Assert(list_member_ptr(estate->es_insert_pending_result_relations,
+						   resultRelInfo));
+
+	resultRelInfo->ri_NumSlots++;
+
+	MemoryContextSwitchTo(oldContext);
+}
+
 /* ----------------------------------------------------------------
  *		ExecBatchInsert
  *
  *		Insert multiple tuples in an efficient way.
- *		Currently, this handles inserting into a foreign table without
- *		RETURNING clause.
+ *		This handles inserting into a foreign table, or into a plain
+ *		table via table_multi_insert; in either case batching is only
+ *		used without a RETURNING clause.
  * ----------------------------------------------------------------
  */
 static void
@@ -1377,17 +1424,40 @@ ExecBatchInsert(ModifyTableState *mtstate,
 	TupleTableSlot *slot = NULL;
 	TupleTableSlot **rslots;
 
-	/*
-	 * insert into foreign table: let the FDW do it
-	 */
-	rslots = resultRelInfo->ri_FdwRoutine->ExecForeignBatchInsert(estate,
-																  resultRelInfo,
-																  slots,
-																  planSlots,
-																  &numInserted);
+	if (resultRelInfo->ri_FdwRoutine)
+	{
+		/*
+		 * insert into foreign table: let the FDW do it
+		 */
+		rslots = resultRelInfo->ri_FdwRoutine->ExecForeignBatchInsert(estate,
+																	  resultRelInfo,
+																	  slots,
+																	  planSlots,
+																	  &numInserted);
+	}
+	else
+	{
+		MemoryContext oldcontext;
+
+		/*
+		 * insert into plain table: write the whole batch with a single
+		 * table_multi_insert call.  Like COPY, we do this in the per-tuple
+		 * memory context so that any data the AM allocates (e.g. copies of
+		 * the tuples) is reclaimed promptly.
+		 */
+		oldcontext = MemoryContextSwitchTo(GetPerTupleMemoryContext(estate));
+		table_multi_insert(resultRelInfo->ri_RelationDesc,
+						   slots, numSlots,
+						   estate->es_output_cid, 0, NULL);
+		MemoryContextSwitchTo(oldcontext);
+
+		rslots = slots;
+	}
 
 	for (i = 0; i < numInserted; i++)
 	{
+		List	   *recheckIndexes = NIL;
+
 		slot = rslots[i];
 
 		/*
@@ -1396,10 +1466,20 @@ ExecBatchInsert(ModifyTableState *mtstate,
 		 */
 		slot->tts_tableOid = RelationGetRelid(resultRelInfo->ri_RelationDesc);
 
+		/* for plain tables, insert index entries for the tuple */
+		if (resultRelInfo->ri_FdwRoutine == NULL &&
+			resultRelInfo->ri_NumIndices > 0)
+			recheckIndexes = ExecInsertIndexTuples(resultRelInfo,
+												   slot, estate, false,
+												   false, NULL, NIL,
+												   false);
+
 		/* AFTER ROW INSERT Triggers */
-		ExecARInsertTriggers(estate, resultRelInfo, slot, NIL,
+		ExecARInsertTriggers(estate, resultRelInfo, slot, recheckIndexes,
 							 mtstate->mt_transition_capture);
 
+		list_free(recheckIndexes);
+
 		/*
 		 * Check any WITH CHECK OPTION constraints from parent views.  See the
 		 * comment in ExecInsert.
@@ -1421,7 +1501,7 @@ ExecBatchInsert(ModifyTableState *mtstate,
 }
 
 /*
- * ExecPendingInserts -- flushes all pending inserts to the foreign tables
+ * ExecPendingInserts -- flushes all pending inserts to the target tables
  */
 static void
 ExecPendingInserts(EState *estate)
@@ -2708,6 +2788,18 @@ redo_act:
  *
  * Returns true if we're done (with or without an update), or false if
  * the caller must retry the INSERT from scratch.
+ *
+ * Note that when many sessions upsert the same key, they serialize here on
+ * the conflicting tuple's row lock (and, when no committed conflict exists
+ * yet, on the speculative insertion token).  That serialization is not an
+ * implementation accident that could be relieved by merging concurrent
+ * updates into one operation: each session's update must be a separate
+ * tuple version, created by its own transaction, so that it can roll back
+ * independently, fire that session's row triggers, and produce that
+ * session's RETURNING row.  Combining updates from different transactions
+ * would expose uncommitted state across transaction boundaries.  Workloads
+ * bound by a single hot key need to aggregate on the client side or spread
+ * the counter over multiple rows.
  */
 static bool
 ExecOnConflictUpdate(ModifyTableContext *context,
@@ -4652,6 +4744,10 @@ ExecInitModifyTable(ModifyTable *node, EState *estate, int eflags)
 	ListCell   *l;
 	int			i;
 	Relation	rel;
+	AttrNumber	ctid_attno;
+	AttrNumber	wholerow_attno;
+	bool		ctid_attno_valid;
+	bool		wholerow_attno_valid;
 
 	/* check for unsupported flags */
 	Assert(!(eflags & (EXEC_FLAG_BACKWARD | EXEC_FLAG_MARK)));
@@ -4847,7 +4943,14 @@ ExecInitModifyTable(ModifyTable *node, EState *estate, int eflags)
 
 	/*
 	 * Do additional per-result-relation initialization.
+	 *
+	 * The junk attribute positions depend only on the subplan's targetlist,
+	 * not on the result relation, so look each one up at most once rather
+	 * than rescanning the targetlist for every result relation; with many
+	 * partitions that repeated scanning shows up in plan startup time.
 	 */
+	ctid_attno = wholerow_attno = InvalidAttrNumber;
+	ctid_attno_valid = wholerow_attno_valid = false;
 	for (i = 0; i < nrels; i++)
 	{
 		resultRelInfo = &mtstate->resultRelInfo[i];
@@ -4882,8 +4985,14 @@ ExecInitModifyTable(ModifyTable *node, EState *estate, int eflags)
 				relkind == RELKIND_MATVIEW ||
 				relkind == RELKIND_PARTITIONED_TABLE)
 			{
-				resultRelInfo->ri_RowIdAttNo =
-					ExecFindJunkAttributeInTlist(subplan->targetlist, "ctid");
+				if (!ctid_attno_valid)
+				{
+					ctid_attno =
+						ExecFindJunkAttributeInTlist(subplan->targetlist,
+													 "ctid");
+					ctid_attno_valid = true;
+				}
+				resultRelInfo->ri_RowIdAttNo = ctid_attno;
 				if (!AttributeNumberIsValid(resultRelInfo->ri_RowIdAttNo))
 					elog(ERROR, "could not find junk ctid column");
 			}
@@ -4901,9 +5010,14 @@ ExecInitModifyTable(ModifyTable *node, EState *estate, int eflags)
 				 * UPDATE and MERGE, so we can get the values of unchanged
 				 * columns.
 				 */
-				resultRelInfo->ri_RowIdAttNo =
-					ExecFindJunkAttributeInTlist(subplan->targetlist,
-												 "wholerow");
+				if (!wholerow_attno_valid)
+				{
+					wholerow_attno =
+						ExecFindJunkAttributeInTlist(subplan->targetlist,
+													 "wholerow");
+					wholerow_attno_valid = true;
+				}
+				resultRelInfo->ri_RowIdAttNo = wholerow_attno;
 				if ((mtstate->operation == CMD_UPDATE || mtstate->operation == CMD_MERGE) &&
 					!AttributeNumberIsValid(resultRelInfo->ri_RowIdAttNo))
 					elog(ERROR, "could not find junk wholerow column");
@@ -4911,9 +5025,14 @@ ExecInitModifyTable(ModifyTable *node, EState *estate, int eflags)
 			else
 			{
 				/* Other valid target relkinds must provide wholerow */
-				resultRelInfo->ri_RowIdAttNo =
-					ExecFindJunkAttributeInTlist(subplan->targetlist,
-												 "wholerow");
+				if (!wholerow_attno_valid)
+				{
+					wholerow_attno =
+						ExecFindJunkAttributeInTlist(subplan->targetlist,
+													 "wholerow");
+					wholerow_attno_valid = true;
+				}
+				resultRelInfo->ri_RowIdAttNo = wholerow_attno;
 				if (!AttributeNumberIsValid(resultRelInfo->ri_RowIdAttNo))
 					elog(ERROR, "could not find junk wholerow column");
 			}
@@ -5162,7 +5281,9 @@ ExecInitModifyTable(ModifyTable *node, EState *estate, int eflags)
 	/*
 	 * Determine if the FDW supports batch insert and determine the batch size
 	 * (a FDW may support batching, but it may be disabled for the
-	 * server/table).
+	 * server/table).  For plain tables, use multi-insert batching when the
+	 * planner found the query safe for it and nothing about the relation
+	 * requires per-row results.
 	 *
 	 * We only do this for INSERT, so that for UPDATE/DELETE the batch size
 	 * remains set to 0.
@@ -5181,6 +5302,25 @@ ExecInitModifyTable(ModifyTable *node, EState *estate, int eflags)
 				resultRelInfo->ri_FdwRoutine->GetForeignModifyBatchSize(resultRelInfo);
 			Assert(resultRelInfo->ri_BatchSize >= 1);
 		}
+		else if (node->canBatchInsert &&
+				 resultRelInfo->ri_FdwRoutine == NULL &&
+				 resultRelInfo->ri_RelationDesc->rd_rel->relkind == RELKIND_RELATION &&
+				 mtstate->mt_partition_tuple_routing == NULL &&
+				 node->onConflictAction == ONCONFLICT_NONE &&
+				 node->returningLists == NIL &&
+				 (resultRelInfo->ri_TrigDesc == NULL ||
+				  (!resultRelInfo->ri_TrigDesc->trig_insert_before_row &&
+				   !resultRelInfo->ri_TrigDesc->trig_insert_instead_row)))
+		{
+			/*
+			 * Mirroring the conditions COPY applies to multi-inserts: BEFORE
+			 * or INSTEAD OF row triggers might query the target table and
+			 * expect to see previously-inserted rows, tuple routing and ON
+			 * CONFLICT need to handle each row individually, and RETURNING
+			 * must produce a result row per input row.
+			 */
+			resultRelInfo->ri_BatchSize = EXEC_INSERT_BATCH_SIZE;
+		}
 		else
 			resultRelInfo->ri_BatchSize = 1;
 	}
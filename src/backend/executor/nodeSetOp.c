@@ -32,6 +32,16 @@
  * output tuples are just copies of the first-to-arrive tuple in each
  * input group.
  *
+ * SetOp is not parallel-aware.  A partial/finalize split on the model of
+ * parallel aggregation would be sound in principle — per-group counts from
+ * both inputs combine by addition — but it needs a combining phase that
+ * merges workers' hash tables (including spilled partitions), and unlike
+ * aggregation there is no transition-function framework to hang the
+ * serialize/combine logic on; it would all be bespoke executor code.  So
+ * far the demand has not justified that: UNION takes the aggregation path
+ * and parallelizes there, and large INTERSECT/EXCEPT can often be
+ * rewritten as joins when parallelism matters.
+ *
  *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
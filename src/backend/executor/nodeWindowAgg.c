@@ -22,6 +22,16 @@
  * As required by the SQL spec, the output represents the value of the
  * aggregate function over all rows in the current row's window frame.
  *
+ * XXX Window functions are parallel-restricted, and necessarily so for now:
+ * evaluating them requires seeing an entire PARTITION BY group, but parallel
+ * table scans deal out blocks to workers with no notion of partition
+ * locality, and the executor has no repartitioning (exchange) operator that
+ * could route rows to workers by hash of the partitioning keys.  Until such
+ * an operator exists, a WindowAgg can sit above a Gather but never below
+ * one.  Note that memory pressure is already handled incrementally: rows
+ * enter the tuplestore as the partition is read and are trimmed from below
+ * once no read pointer can reach them, so bounded frames don't materialize
+ * the whole partition at once.
  *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -454,6 +464,16 @@ advance_windowaggregate(WindowAggState *winstate,
  * the inverse transition function (which caller must have checked is
  * available).
  *
+ * Note that although the surrounding code looks per-row, the expensive
+ * parts are already incremental: the frame head only ever moves forward,
+ * so eval_windowaggregates applies this function exactly once per row that
+ * leaves the frame, and batching those calls couldn't reduce their number.
+ * Nor is there a per-row copy of the transition value for the interesting
+ * aggregates — when the inverse function returns its own first argument
+ * (as the numeric/int8 moving aggregates do with their internal-typed
+ * state) or a R/W expanded object owned by aggcontext, the copy stanza in
+ * advance_windowaggregate is skipped and the state mutates in place.
+ *
  * Returns true if we successfully removed the current row from this
  * aggregate, false if not (in the latter case, caller is responsible
  * for cleaning up by restarting the aggregation).
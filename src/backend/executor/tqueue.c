@@ -8,6 +8,14 @@
  *
  * A TupleQueueReader reads tuples from a shm_mq and returns the tuples.
  *
+ * Although tuples pass through the queue one at a time, transfer is
+ * effectively batched: shm_mq defers publishing written bytes (and setting
+ * the receiver's latch) until a quarter of the ring has accumulated, the
+ * receiver likewise publishes consumed bytes lazily, and unwrapped messages
+ * are returned as pointers into the ring without copying.  Adding a
+ * tuple-batching layer here would duplicate that machinery; if per-tuple
+ * overhead shows up in profiles, look at the thresholds in shm_mq.c first.
+ *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
@@ -39,6 +39,7 @@ bool		jit_tuple_deforming = true;
 double		jit_above_cost = 100000;
 double		jit_inline_above_cost = 500000;
 double		jit_optimize_above_cost = 500000;
+int			jit_inline_threshold = 512;
 
 static JitProviderCallbacks provider;
 static bool provider_successfully_loaded = false;
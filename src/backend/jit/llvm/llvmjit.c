@@ -277,6 +277,9 @@ llvm_release_context(JitContext *context)
 		llvm_jit_context->module = NULL;
 	}
 
+	list_free_deep(llvm_jit_context->deform_cache);
+	llvm_jit_context->deform_cache = NIL;
+
 	foreach(lc, llvm_jit_context->handles)
 	{
 		LLVMJitHandle *jit_handle = (LLVMJitHandle *) lfirst(lc);
@@ -626,8 +629,8 @@ llvm_optimize_module(LLVMJitContext *context, LLVMModuleRef module)
 
 	if (context->base.flags & PGJIT_OPT3)
 	{
-		/* TODO: Unscientifically determined threshold */
-		LLVMPassManagerBuilderUseInlinerWithThreshold(llvm_pmb, 512);
+		LLVMPassManagerBuilderUseInlinerWithThreshold(llvm_pmb,
+													  jit_inline_threshold);
 	}
 	else
 	{
@@ -688,7 +691,7 @@ llvm_optimize_module(LLVMJitContext *context, LLVMModuleRef module)
 	LLVMPassBuilderOptionsSetVerifyEach(options, true);
 #endif
 
-	LLVMPassBuilderOptionsSetInlinerThreshold(options, 512);
+	LLVMPassBuilderOptionsSetInlinerThreshold(options, jit_inline_threshold);
 
 	err = LLVMRunPasses(module, passes, NULL, options);
 
@@ -801,6 +804,10 @@ llvm_compile_module(LLVMJitContext *context)
 	context->module = NULL;
 	context->compiled = true;
 
+	/* cached deform functions referenced the now-emitted module */
+	list_free_deep(context->deform_cache);
+	context->deform_cache = NIL;
+
 	/* remember emitted code for cleanup and lookups */
 	oldcontext = MemoryContextSwitchTo(TopMemoryContext);
 	context->handles = lappend(context->handles, handle);
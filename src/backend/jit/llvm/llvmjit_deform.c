@@ -25,8 +25,24 @@
 #include "executor/tuptable.h"
 #include "jit/llvmjit.h"
 #include "jit/llvmjit_emit.h"
+#include "utils/memutils.h"
 
 
+/*
+ * Deform functions already generated into the context's current module,
+ * so that expressions touching the same rowtype several times within one
+ * compilation reuse a single function instead of emitting duplicates.
+ * Entries are dropped whenever the module they belong to is emitted or
+ * disposed (see llvmjit.c).
+ */
+typedef struct DeformCacheEntry
+{
+	TupleDesc	desc;
+	const TupleTableSlotOps *ops;
+	int			natts;
+	LLVMValueRef fn;
+} DeformCacheEntry;
+
 /*
  * Create a function that deforms a tuple of type desc up to natts columns.
  */
@@ -102,6 +118,19 @@ slot_compile_deform(LLVMJitContext *context, TupleDesc desc,
 	mod = llvm_mutable_module(context);
 	lc = LLVMGetModuleContext(mod);
 
+	/*
+	 * Reuse an identical deform function if we already built one in this
+	 * module.  Comparing the TupleDesc by pointer is sufficient: repeated
+	 * compilations for one rowtype within a single expression tree pass the
+	 * same (refcounted) descriptor, and a false negative merely costs a
+	 * duplicate function.
+	 */
+	foreach_ptr(DeformCacheEntry, entry, context->deform_cache)
+	{
+		if (entry->desc == desc && entry->ops == ops && entry->natts == natts)
+			return entry->fn;
+	}
+
 	funcname = llvm_expand_funcname(context, "deform");
 
 	/*
@@ -760,5 +789,20 @@ slot_compile_deform(LLVMJitContext *context, TupleDesc desc,
 
 	LLVMDisposeBuilder(b);
 
+	/* remember the function for reuse while this module stays open */
+	{
+		DeformCacheEntry *entry;
+		MemoryContext oldcontext = MemoryContextSwitchTo(TopMemoryContext);
+
+		entry = palloc_object(DeformCacheEntry);
+		entry->desc = desc;
+		entry->ops = ops;
+		entry->natts = natts;
+		entry->fn = v_deform_fn;
+		context->deform_cache = lappend(context->deform_cache, entry);
+
+		MemoryContextSwitchTo(oldcontext);
+	}
+
 	return v_deform_fn;
 }
@@ -29,6 +29,7 @@
 
 #include "libpq/libpq.h"
 #include "miscadmin.h"
+#include "storage/aio.h"
 #include "tcop/tcopprot.h"
 #include "utils/injection_point.h"
 #include "utils/wait_event.h"
@@ -252,6 +253,15 @@ retry:
 			 * socket to become ready again.
 			 */
 		}
+
+		/*
+		 * Reap any ready AIO completions; the completion fd stays readable
+		 * until we do, so failing to would busy-loop here.  (See
+		 * pq_add_aio_completion_event().)
+		 */
+		if (event.pos == FeBeWaitSetAioPos)
+			pgaio_process_completions();
+
 		goto retry;
 	}
 
@@ -361,6 +371,11 @@ retry:
 			 * for the socket to become ready again.
 			 */
 		}
+
+		/* See comments in secure_read. */
+		if (event.pos == FeBeWaitSetAioPos)
+			pgaio_process_completions();
+
 		goto retry;
 	}
 
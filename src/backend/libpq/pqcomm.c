@@ -77,7 +77,9 @@
 #include "miscadmin.h"
 #include "port/pg_bswap.h"
 #include "postmaster/postmaster.h"
+#include "storage/aio.h"
 #include "storage/ipc.h"
+#include "utils/guc.h"
 #include "utils/guc_hooks.h"
 #include "utils/memutils.h"
 
@@ -112,8 +114,9 @@ static List *sock_paths = NIL;
 /*
  * Buffers for low-level I/O.
  *
- * The receive buffer is fixed size. Send buffer is usually 8k, but can be
- * enlarged by pq_putmessage_noblock() if the message doesn't fit otherwise.
+ * The receive buffer is fixed size.  The send buffer starts out at
+ * client_send_buffer_size (normally 8k), but can be enlarged by
+ * pq_putmessage_noblock() if a message doesn't fit otherwise.
  */
 
 #define PQ_SEND_BUFFER_SIZE 8192
@@ -250,7 +253,7 @@ pq_init(ClientSocket *client_sock)
 			ereport(FATAL,
 					(errmsg("%s(%s) failed: %m", "getsockopt", "SO_SNDBUF")));
 		}
-		newopt = PQ_SEND_BUFFER_SIZE * 4;
+		newopt = Max(PQ_SEND_BUFFER_SIZE * 4, client_send_buffer_size);
 		if (oldopt < newopt)
 		{
 			if (setsockopt(port->sock, SOL_SOCKET, SO_SNDBUF, (char *) &newopt,
@@ -276,7 +279,7 @@ pq_init(ClientSocket *client_sock)
 	}
 
 	/* initialize state variables */
-	PqSendBufferSize = PQ_SEND_BUFFER_SIZE;
+	PqSendBufferSize = Max(client_send_buffer_size, PQ_SEND_BUFFER_SIZE);
 	PqSendBuffer = MemoryContextAlloc(TopMemoryContext, PqSendBufferSize);
 	PqSendPointer = PqSendStart = PqRecvPointer = PqRecvLength = 0;
 	PqCommBusy = false;
@@ -314,7 +317,8 @@ pq_init(ClientSocket *client_sock)
 
 	/*
 	 * The event positions match the order we added them, but let's sanity
-	 * check them to be sure.
+	 * check them to be sure.  (The FeBeWaitSetAioPos slot is left free here;
+	 * see pq_add_aio_completion_event().)
 	 */
 	Assert(socket_pos == FeBeWaitSetSocketPos);
 	Assert(latch_pos == FeBeWaitSetLatchPos);
@@ -322,6 +326,40 @@ pq_init(ClientSocket *client_sock)
 	return port;
 }
 
+/* --------------------------------
+ *		pq_add_aio_completion_event - watch for AIO completions, if possible
+ *
+ * If the active AIO method exposes a file descriptor that becomes readable
+ * when asynchronous I/O completions are waiting (io_method=io_uring does),
+ * add it to FeBeWaitSet.  That way a backend blocked on the client socket
+ * also wakes up when one of its I/Os completes, and can process the
+ * completion right away instead of leaving it to whichever backend next
+ * waits on that I/O.  Wait sites must consume such events by calling
+ * pgaio_process_completions(), or the level-triggered fd would wake them
+ * again immediately.
+ *
+ * This cannot happen in pq_init(), because the AIO subsystem is initialized
+ * later; it is called from BaseInit() once pgaio_init_backend() has run.
+ * --------------------------------
+ */
+void
+pq_add_aio_completion_event(void)
+{
+	int			fd;
+	int			aio_pos PG_USED_FOR_ASSERTS_ONLY;
+
+	if (FeBeWaitSet == NULL)
+		return;
+
+	fd = pgaio_completion_fd();
+	if (fd < 0)
+		return;
+
+	aio_pos = AddWaitEventToSet(FeBeWaitSet, WL_SOCKET_READABLE, fd,
+								NULL, NULL);
+	Assert(aio_pos == FeBeWaitSetAioPos);
+}
+
 /* --------------------------------
  *		socket_comm_reset - reset libpq during error recovery
  *
@@ -1526,6 +1564,77 @@ socket_putmessage_noblock(char msgtype, const char *s, size_t len)
 	int			res PG_USED_FOR_ASSERTS_ONLY;
 	int			required;
 
+	Assert(msgtype != 0);
+
+	/*
+	 * For messages at least as large as the send buffer, try to push bytes
+	 * to the socket directly instead of copying the whole message into an
+	 * enlarged buffer just so it can be copied out again later: drain
+	 * whatever is buffered, emit the header, and then send the payload
+	 * straight from the caller's buffer, buffering only whatever part the
+	 * socket can't accept right away.  This matters for bulk paths like the
+	 * walsender, whose messages are routinely much larger than the buffer.
+	 */
+	if (len >= (size_t) PqSendBufferSize && !PqCommBusy)
+	{
+		PqCommBusy = true;
+		socket_set_nonblocking(true);
+
+		/* try to drain already-buffered data first */
+		if (PqSendStart < PqSendPointer && internal_flush() == EOF)
+		{
+			PqCommBusy = false;
+			return;				/* connection lost, data dropped */
+		}
+
+		if (PqSendStart == PqSendPointer)
+		{
+			uint32		n32;
+			size_t		start = 0;
+			size_t		end = len;
+
+			/* buffer is empty, so the five header bytes surely fit */
+			PqSendStart = PqSendPointer = 0;
+			PqSendBuffer[PqSendPointer++] = msgtype;
+			n32 = pg_hton32((uint32) (len + 4));
+			memcpy(PqSendBuffer + PqSendPointer, &n32, 4);
+			PqSendPointer += 4;
+
+			/* send the header, then the payload directly from *s */
+			if (internal_flush() == EOF)
+			{
+				PqCommBusy = false;
+				return;
+			}
+			if (PqSendStart == PqSendPointer &&
+				internal_flush_buffer(s, &start, &end) == EOF)
+			{
+				PqCommBusy = false;
+				return;
+			}
+
+			/* buffer whatever part of the payload wasn't accepted */
+			s += start;
+			len = end - start;
+			if (len > 0)
+			{
+				required = PqSendPointer + len;
+				if (required > PqSendBufferSize)
+				{
+					PqSendBuffer = repalloc(PqSendBuffer, required);
+					PqSendBufferSize = required;
+				}
+				memcpy(PqSendBuffer + PqSendPointer, s, len);
+				PqSendPointer += len;
+			}
+			PqCommBusy = false;
+			return;
+		}
+
+		/* couldn't empty the buffer; fall back to buffering the message */
+		PqCommBusy = false;
+	}
+
 	/*
 	 * Ensure we have enough space in the output buffer for the message header
 	 * as well as the message itself.
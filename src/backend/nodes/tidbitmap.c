@@ -213,8 +213,17 @@ struct TBMSharedIterator
 	PTEntryArray *ptbase;		/* pagetable element array */
 	PTIterationArray *ptpages;	/* sorted exact page index list */
 	PTIterationArray *ptchunks; /* sorted lossy page index list */
+	int			claim_next;		/* next locally claimed ptpages index */
+	int			claim_stop;		/* end of locally claimed index range */
 };
 
+/*
+ * Maximum number of exact pages a process claims from a shared iterator in
+ * one go.  Claiming a batch keeps workers off the iterator lock for most
+ * pages, while staying small enough not to skew work distribution.
+ */
+#define TBM_SHARED_CLAIM_PAGES	8
+
 /* Local function prototypes */
 static void tbm_union_page(TIDBitmap *a, const PagetableEntry *bpage);
 static bool tbm_intersect_page(TIDBitmap *a, PagetableEntry *apage,
@@ -1069,6 +1078,19 @@ tbm_shared_iterate(TBMSharedIterator *iterator, TBMIterateResult *tbmres)
 	if (iterator->ptchunks != NULL)
 		idxchunks = iterator->ptchunks->index;
 
+	/* Serve pages claimed in a batch earlier without taking the lock */
+	if (iterator->claim_next < iterator->claim_stop)
+	{
+		PagetableEntry *page = &ptbase[idxpages[iterator->claim_next++]];
+
+		tbmres->internal_page = page;
+		tbmres->blockno = page->blockno;
+		tbmres->lossy = false;
+		tbmres->recheck = page->recheck;
+
+		return true;
+	}
+
 	/* Acquire the LWLock before accessing the shared members */
 	LWLockAcquire(&istate->lock, LW_EXCLUSIVE);
 
@@ -1128,6 +1150,22 @@ tbm_shared_iterate(TBMSharedIterator *iterator, TBMIterateResult *tbmres)
 		tbmres->recheck = page->recheck;
 		istate->spageptr++;
 
+		/*
+		 * Once the lossy chunks are exhausted the remaining exact pages can
+		 * be handed out in any interleaving, so grab a batch of them while
+		 * we hold the lock and serve the rest from local state above.
+		 */
+		if (istate->schunkptr >= istate->nchunks &&
+			istate->spageptr < istate->npages)
+		{
+			int			nclaimed = Min(TBM_SHARED_CLAIM_PAGES,
+									   istate->npages - istate->spageptr);
+
+			iterator->claim_next = istate->spageptr;
+			iterator->claim_stop = istate->spageptr + nclaimed;
+			istate->spageptr += nclaimed;
+		}
+
 		LWLockRelease(&istate->lock);
 
 		return true;
@@ -1354,26 +1392,18 @@ tbm_mark_page_lossy(TIDBitmap *tbm, BlockNumber pageno)
 }
 
 /*
- * tbm_lossify - lose some information to get back under the memory limit
+ * tbm_lossify_pass - one sweep of lossification over the hashtable
+ *
+ * Exact pages with fewer than min_ntuples bits set are left alone; pass
+ * zero to lossify unconditionally.  Returns true once enough room has been
+ * made, i.e. nentries has been pushed down to maxentries / 2.
  */
-static void
-tbm_lossify(TIDBitmap *tbm)
+static bool
+tbm_lossify_pass(TIDBitmap *tbm, int min_ntuples)
 {
 	pagetable_iterator i;
 	PagetableEntry *page;
 
-	/*
-	 * XXX Really stupid implementation: this just lossifies pages in
-	 * essentially random order.  We should be paying some attention to the
-	 * number of bits set in each page, instead.
-	 *
-	 * Since we are called as soon as nentries exceeds maxentries, we should
-	 * push nentries down to significantly less than maxentries, or else we'll
-	 * just end up doing this again very soon.  We shoot for maxentries/2.
-	 */
-	Assert(tbm->iterating == TBM_NOT_ITERATING);
-	Assert(tbm->status == TBM_HASH);
-
 	pagetable_start_iterate_at(tbm->pagetable, &i, tbm->lossify_start);
 	while ((page = pagetable_iterate(tbm->pagetable, &i)) != NULL)
 	{
@@ -1387,6 +1417,22 @@ tbm_lossify(TIDBitmap *tbm)
 		if ((page->blockno % PAGES_PER_CHUNK) == 0)
 			continue;
 
+		/*
+		 * Skip sparse pages when asked to.  Making a dense page lossy loses
+		 * little, because the heap scan was going to visit most of its
+		 * tuples anyway, while a sparse page turned lossy means rechecking
+		 * a whole page to find a handful of matches.
+		 */
+		if (min_ntuples > 0)
+		{
+			int			nbits = 0;
+
+			for (int w = 0; w < WORDS_PER_PAGE; w++)
+				nbits += bmw_popcount(page->words[w]);
+			if (nbits < min_ntuples)
+				continue;
+		}
+
 		/* This does the dirty work ... */
 		tbm_mark_page_lossy(tbm, page->blockno);
 
@@ -1397,7 +1443,7 @@ tbm_lossify(TIDBitmap *tbm)
 			 * next round, so we evenly iterate over the hashtable.
 			 */
 			tbm->lossify_start = i.cur;
-			break;
+			return true;
 		}
 
 		/*
@@ -1408,6 +1454,32 @@ tbm_lossify(TIDBitmap *tbm)
 		 */
 	}
 
+	return false;
+}
+
+/*
+ * tbm_lossify - lose some information to get back under the memory limit
+ */
+static void
+tbm_lossify(TIDBitmap *tbm)
+{
+	/*
+	 * Since we are called as soon as nentries exceeds maxentries, we should
+	 * push nentries down to significantly less than maxentries, or else we'll
+	 * just end up doing this again very soon.  We shoot for maxentries/2.
+	 *
+	 * Prefer to sacrifice dense pages: they cost the least extra recheck
+	 * work when turned lossy.  Only if a sweep over the dense pages doesn't
+	 * free enough entries do we lossify indiscriminately.
+	 */
+	Assert(tbm->iterating == TBM_NOT_ITERATING);
+	Assert(tbm->status == TBM_HASH);
+
+	if (tbm_lossify_pass(tbm, TBM_MAX_TUPLES_PER_PAGE / 2))
+		return;
+	if (tbm_lossify_pass(tbm, 0))
+		return;
+
 	/*
 	 * With a big bitmap and small work_mem, it's possible that we cannot get
 	 * under maxentries.  Again, if that happens, we'd end up uselessly
@@ -62,6 +62,7 @@ geqo_eval(PlannerInfo *root, Gene *tour, int num_gene)
 	Cost		fitness;
 	int			savelength;
 	struct HTAB *savehash;
+	struct HTAB *saverinfohash;
 
 	/*
 	 * Create a private memory context that will hold all temp storage
@@ -85,18 +86,21 @@ geqo_eval(PlannerInfo *root, Gene *tour, int num_gene)
 	 * truncating the list to its original length.  NOTE this assumes that any
 	 * added entries are appended at the end!
 	 *
-	 * We also must take care not to mess up the outer join_rel_hash, if there
-	 * is one.  We can do this by just temporarily setting the link to NULL.
-	 * (If we are dealing with enough join rels, which we very likely are, a
-	 * new hash table will get built and used locally.)
+	 * We also must take care not to mess up the outer join_rel_hash or
+	 * child_rinfo_hash, if there are any.  We can do this by just temporarily
+	 * setting the links to NULL.  (If we are dealing with enough join rels,
+	 * which we very likely are, new hash tables will get built and used
+	 * locally.)
 	 *
 	 * join_rel_level[] shouldn't be in use, so just Assert it isn't.
 	 */
 	savelength = list_length(root->join_rel_list);
 	savehash = root->join_rel_hash;
+	saverinfohash = root->child_rinfo_hash;
 	Assert(root->join_rel_level == NULL);
 
 	root->join_rel_hash = NULL;
+	root->child_rinfo_hash = NULL;
 
 	/* construct the best path for the given combination of relations */
 	joinrel = gimme_tree(root, tour, num_gene);
@@ -124,6 +128,7 @@ geqo_eval(PlannerInfo *root, Gene *tour, int num_gene)
 	root->join_rel_list = list_truncate(root->join_rel_list,
 										savelength);
 	root->join_rel_hash = savehash;
+	root->child_rinfo_hash = saverinfohash;
 
 	/* release all the memory acquired within gimme_tree */
 	MemoryContextSwitchTo(oldcxt);
@@ -68,6 +68,19 @@ static int	gimme_number_generations(int pool_size);
  * geqo
  *	  solution of the query optimization problem
  *	  similar to a constrained Traveling Salesman Problem (TSP)
+ *
+ * Although the search is randomized, it is reproducible: the private RNG
+ * is re-seeded from the geqo_seed GUC for every invocation, so the same
+ * query with the same statistics and settings yields the same join order.
+ * Sites seeing run-to-run plan variance should check for a changed
+ * geqo_seed or drifting statistics before blaming the algorithm.
+ * Replacing GEQO with a deterministic budget-bounded DP (DPhyp and
+ * friends) remains an open research project; anyone wanting to experiment
+ * can supply such an enumerator through join_search_hook without touching
+ * this code, which is exactly what that hook is for.  Raising
+ * geqo_threshold (and the collapse limits) is often the pragmatic fix,
+ * since standard DP handles more relations than people expect on modern
+ * hardware.
  */
 
 RelOptInfo *
@@ -34,6 +34,17 @@
  * disk.  Per-tablespace overrides never apply to temporary work files such as
  * an external sort or a materialize node that overflows work_mem.
  *
+ * An in-core command that benchmarks the storage and writes these
+ * tablespace options automatically has been suggested, since the default
+ * random/sequential ratio badly overstates seek costs on flash storage.
+ * The sticking point is that these are not device parameters: what the
+ * planner needs is the effective cost including the probability of a cache
+ * hit, which depends on shared_buffers, the kernel cache, and the working
+ * set — a cold raw-device benchmark would measure the wrong thing and
+ * write it into the catalog with an air of authority.  Administrators who
+ * know their storage should simply set the tablespace options; fio-style
+ * numbers are a starting point, not the answer.
+ *
  * We compute two separate costs for each path:
  *		total_cost: total estimated cost to fetch all tuples
  *		startup_cost: cost that is expended before first tuple is fetched
@@ -1778,12 +1778,13 @@ try_partitionwise_join(PlannerInfo *root, RelOptInfo *rel1, RelOptInfo *rel2,
 
 		/*
 		 * Construct restrictions applicable to the child join from those
-		 * applicable to the parent join.
+		 * applicable to the parent join.  This memoizes the translations, so
+		 * that revisiting the same child join through a different pair of
+		 * input relations reuses them.
 		 */
 		child_restrictlist =
-			(List *) adjust_appendrel_attrs(root,
-											(Node *) parent_restrictlist,
-											nappinfos, appinfos);
+			adjust_child_restrictlist(root, parent_restrictlist,
+									  child_relids, nappinfos, appinfos);
 
 		/* Find or construct the child join's RelOptInfo */
 		child_joinrel = joinrel->part_rels[cnt_parts];
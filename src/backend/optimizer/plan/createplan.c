@@ -7030,6 +7030,18 @@ make_modifytable(PlannerInfo *root, Plan *subplan,
 
 	node->operation = operation;
 	node->canSetTag = canSetTag;
+
+	/*
+	 * Batched inserts buffer new tuples during execution, so they must not
+	 * be used if anything in the query could observe the target table
+	 * mid-statement: volatile functions (other than nextval) may run queries
+	 * that would see the rows already inserted by this command, and
+	 * modifying CTEs touch tables directly.  The remaining, per-relation
+	 * conditions are checked at executor startup.
+	 */
+	node->canBatchInsert = (operation == CMD_INSERT &&
+							!root->parse->hasModifyingCTE &&
+							!contain_volatile_functions_not_nextval((Node *) root->parse));
 	node->nominalRelation = nominalRelation;
 	node->rootRelation = rootRelation;
 	node->resultRelations = resultRelations;
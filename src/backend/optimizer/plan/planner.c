@@ -310,6 +310,16 @@ static void create_partial_unique_paths(PlannerInfo *root, RelOptInfo *input_rel
  * Note to plugin authors: standard_planner() scribbles on its Query input,
  * so you'd better copy that data structure if you want to plan more than once.
  *
+ * This hook, paired with ExecutorEnd_hook, is also the intended attachment
+ * point for plan-capture tooling: fingerprinting each query's current plan,
+ * noticing when it flips, and attributing a latency regression to the flip.
+ * We deliberately keep that out of core — a compact plan serialization is
+ * variable-length and unbounded, which doesn't fit the fixed-size shared
+ * stats entries, and policy questions (how many plans per query, eviction,
+ * what counts as "different") are better iterated on in an extension.  The
+ * core pieces an implementation needs are already here: queryId, the
+ * per-plan planId reported below, and outfuncs serialization.
+ *
  *****************************************************************************/
 PlannedStmt *
 planner(Query *parse, const char *query_string, int cursorOptions,
@@ -391,6 +401,15 @@ standard_planner(Query *parse, const char *query_string, int cursorOptions,
 	 * we want to allow parallel inserts in general; updates and deletes have
 	 * additional problems especially around combo CIDs.)
 	 *
+	 * (Even for the trigger-free CTAS case, letting the workers do the
+	 * writing — rather than merely feeding tuples to a writing leader —
+	 * needs more than the planner's blessing: parallel mode currently
+	 * forbids workers from assigning XIDs and command IDs, so the
+	 * transaction machinery would have to export those to workers before
+	 * table_multi_insert could run there.  Shared bulk relation extension
+	 * is not the obstacle; ExtendBufferedRelBy already handles multiple
+	 * backends extending the same relation.)
+	 *
 	 * For now, we don't try to use parallel mode if we're running inside a
 	 * parallel worker.  We might eventually be able to relax this
 	 * restriction, but for now it seems best not to have parallel workers
@@ -8123,7 +8142,11 @@ apply_scanjoin_target_to_paths(PlannerInfo *root,
  * and then finalize aggregation.  This is less certain to win than the
  * previous case.  It may win if the PartialAggregate stage greatly reduces
  * the number of groups, because fewer rows will pass through the Append node.
- * It may lose if we have lots of small groups.
+ * It may lose if we have lots of small groups.  Note also that the finalize
+ * stage runs in a single process; distributing it would require an exchange
+ * operator that repartitions partial groups by grouping key across workers,
+ * which the executor does not have.  When the grouping key contains the
+ * partition keys, the first case applies and no finalize stage is needed.
  */
 static void
 create_partitionwise_grouping_paths(PlannerInfo *root,
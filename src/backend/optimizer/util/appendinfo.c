@@ -16,6 +16,7 @@
 
 #include "access/htup_details.h"
 #include "access/table.h"
+#include "common/hashfn.h"
 #include "foreign/fdwapi.h"
 #include "nodes/makefuncs.h"
 #include "nodes/nodeFuncs.h"
@@ -23,6 +24,7 @@
 #include "optimizer/pathnode.h"
 #include "optimizer/planmain.h"
 #include "parser/parsetree.h"
+#include "utils/hsearch.h"
 #include "utils/lsyscache.h"
 #include "utils/rel.h"
 #include "utils/syscache.h"
@@ -215,6 +217,120 @@ adjust_appendrel_attrs(PlannerInfo *root, Node *node, int nappinfos,
 	return adjust_appendrel_attrs_mutator(node, &context);
 }
 
+/* Hash key for the child RestrictInfo translation cache */
+typedef struct ChildRestrictInfoKey
+{
+	RestrictInfo *parent_rinfo; /* clause being translated */
+	Relids		child_relids;	/* relids of the child join */
+} ChildRestrictInfoKey;
+
+typedef struct ChildRestrictInfoEntry
+{
+	ChildRestrictInfoKey key;	/* hash key - must be first */
+	RestrictInfo *child_rinfo;	/* translated clause */
+} ChildRestrictInfoEntry;
+
+static uint32
+child_rinfo_hash(const void *key, Size keysize)
+{
+	const ChildRestrictInfoKey *ckey = (const ChildRestrictInfoKey *) key;
+
+	Assert(keysize == sizeof(ChildRestrictInfoKey));
+	return hash_bytes((const unsigned char *) &ckey->parent_rinfo,
+					  sizeof(RestrictInfo *)) ^
+		bms_hash_value(ckey->child_relids);
+}
+
+static int
+child_rinfo_match(const void *key1, const void *key2, Size keysize)
+{
+	const ChildRestrictInfoKey *ckey1 = (const ChildRestrictInfoKey *) key1;
+	const ChildRestrictInfoKey *ckey2 = (const ChildRestrictInfoKey *) key2;
+
+	Assert(keysize == sizeof(ChildRestrictInfoKey));
+	if (ckey1->parent_rinfo == ckey2->parent_rinfo &&
+		bms_equal(ckey1->child_relids, ckey2->child_relids))
+		return 0;
+	return 1;
+}
+
+/*
+ * adjust_child_restrictlist
+ *	  Translate a list of RestrictInfos to apply to a child join, reusing
+ *	  translations already made for the same clause and the same child.
+ *
+ * A child join is visited by try_partitionwise_join() once for every pair of
+ * input relations that can form the parent join, and most of the parent's
+ * restriction clauses appear in the restrictlist of each such pair.  Caching
+ * the translations in root->child_rinfo_hash means each clause is translated
+ * once per child join rather than once per visit, which adds up when a join
+ * of several partitioned relations has many partitions.  Sharing the
+ * translated RestrictInfo between the visits is safe for the same reason the
+ * parent's restrictlists can share RestrictInfos: the cached fields within
+ * are keyed to the clause, not to any particular join pair.
+ *
+ * 'child_relids' are the relids of the child join.  'nappinfos' and
+ * 'appinfos' describe the same parent-to-child translation as in
+ * adjust_appendrel_attrs(); the caller need not guarantee that child_relids
+ * survives this call.
+ */
+List *
+adjust_child_restrictlist(PlannerInfo *root, List *restrictlist,
+						  Relids child_relids,
+						  int nappinfos, AppendRelInfo **appinfos)
+{
+	List	   *result = NIL;
+	ChildRestrictInfoKey key;
+	Relids		stored_relids = NULL;
+	ListCell   *lc;
+
+	if (root->child_rinfo_hash == NULL)
+	{
+		HASHCTL		hash_ctl;
+
+		hash_ctl.keysize = sizeof(ChildRestrictInfoKey);
+		hash_ctl.entrysize = sizeof(ChildRestrictInfoEntry);
+		hash_ctl.hash = child_rinfo_hash;
+		hash_ctl.match = child_rinfo_match;
+		hash_ctl.hcxt = CurrentMemoryContext;
+		root->child_rinfo_hash =
+			hash_create("ChildRestrictInfoHashTable", 256,
+						&hash_ctl,
+						HASH_ELEM | HASH_FUNCTION | HASH_COMPARE | HASH_CONTEXT);
+	}
+
+	key.child_relids = child_relids;
+
+	foreach(lc, restrictlist)
+	{
+		RestrictInfo *rinfo = lfirst_node(RestrictInfo, lc);
+		ChildRestrictInfoEntry *entry;
+		bool		found;
+
+		key.parent_rinfo = rinfo;
+		entry = (ChildRestrictInfoEntry *)
+			hash_search(root->child_rinfo_hash, &key, HASH_ENTER, &found);
+		if (!found)
+		{
+			/*
+			 * The key stored in the hash table must outlive the caller's
+			 * child_relids; make one durable copy for all entries added on
+			 * this call.  (It hashes and compares identically, so replacing
+			 * the relids in the stored key is harmless.)
+			 */
+			if (stored_relids == NULL)
+				stored_relids = bms_copy(child_relids);
+			entry->key.child_relids = stored_relids;
+			entry->child_rinfo = (RestrictInfo *)
+				adjust_appendrel_attrs(root, (Node *) rinfo,
+									   nappinfos, appinfos);
+		}
+		result = lappend(result, entry->child_rinfo);
+	}
+
+	return result;
+}
+
 static Node *
 adjust_appendrel_attrs_mutator(Node *node,
 							   adjust_appendrel_attrs_context *context)
@@ -839,6 +839,17 @@ prune_append_rel_partitions(RelOptInfo *rel)
  * Note: context->exprcontext must be valid when the pruning_steps were
  * generated with a target other than PARTTARGET_PLANNER.
  *
+ * Compiling the step list into a specialized decision tree (or machine
+ * code) has been suggested for plans executed many times, but the
+ * interpretive overhead here is just this small switch over what is
+ * typically a handful of steps.  The real per-execution work — evaluating
+ * the step's argument expressions and calling the partition support
+ * functions to compare against the bounds — would be identical in compiled
+ * form: the expressions already run as compiled ExprStates, and the bound
+ * comparisons must go through fmgr regardless.  The llvmjit expression
+ * pipeline is also not applicable as-is, since a step program is not an
+ * ExprState.
+ *
  * Returns a Bitmapset of the RelOptInfo->part_rels indexes of the surviving
  * partitions.
  */
@@ -588,6 +588,83 @@ check_huge_page_size(int *newval, void **extra, GucSource source)
 	return true;
 }
 
+#ifdef MAP_HUGETLB
+/*
+ * Create a shared memory segment that is only partially backed by huge
+ * pages: a huge-page region at the start, with the remainder mapped using
+ * normal pages directly behind it, forming one contiguous segment.  This is
+ * used when the huge page pool cannot accommodate the whole segment (a
+ * common situation after long uptime has fragmented or depleted the pool),
+ * so that we can still spend whatever huge pages are available on the
+ * beginning of the segment, where the TLB-hottest structures (the buffer
+ * pool and its descriptors) are placed by shmem initialization.
+ *
+ * totalsize is the full segment size wanted; hugepagesize and hugeflags
+ * come from GetHugePageSize().  On success, returns the segment base and
+ * sets *hugesize to the number of huge-page-backed bytes at its start.
+ * Returns MAP_FAILED (with errno set) if nothing suitable could be mapped.
+ */
+static void *
+CreateHybridSegment(Size totalsize, Size hugepagesize, int hugeflags,
+					Size *hugesize)
+{
+	void	   *base = MAP_FAILED;
+	void	   *rest;
+	void	   *resttarget;
+	Size		trysize;
+	Size		restsize;
+
+	/*
+	 * Probe for the largest huge-page region the kernel will give us,
+	 * halving the request (rounded down to a huge page multiple) on each
+	 * failure.  The full segment size has already been tried and rejected
+	 * by the caller, so start at half.
+	 */
+	trysize = totalsize / 2;
+	trysize -= trysize % hugepagesize;
+	while (trysize >= hugepagesize)
+	{
+		base = mmap(NULL, trysize, PROT_READ | PROT_WRITE,
+					PG_MMAP_FLAGS | hugeflags, -1, 0);
+		if (base != MAP_FAILED)
+			break;
+		trysize = trysize / 2;
+		trysize -= trysize % hugepagesize;
+	}
+	if (base == MAP_FAILED)
+		return MAP_FAILED;
+
+	/*
+	 * Map the remainder with normal pages at the address just past the
+	 * huge-page region.  MAP_FIXED_NOREPLACE makes the kernel refuse rather
+	 * than clobber an existing mapping; where it's not available, pass the
+	 * address as a hint and verify the result.
+	 */
+	resttarget = (char *) base + trysize;
+	restsize = totalsize - trysize;
+#ifdef MAP_FIXED_NOREPLACE
+	rest = mmap(resttarget, restsize, PROT_READ | PROT_WRITE,
+				PG_MMAP_FLAGS | MAP_FIXED_NOREPLACE, -1, 0);
+#else
+	rest = mmap(resttarget, restsize, PROT_READ | PROT_WRITE,
+				PG_MMAP_FLAGS, -1, 0);
+#endif
+	if (rest != resttarget)
+	{
+		int			save_errno = errno;
+
+		if (rest != MAP_FAILED)
+			munmap(rest, restsize);
+		munmap(base, trysize);
+		errno = save_errno ? save_errno : ENOMEM;
+		return MAP_FAILED;
+	}
+
+	*hugesize = trysize;
+	return base;
+}
+#endif							/* MAP_HUGETLB */
+
 /*
  * Creates an anonymous mmap()ed shared memory segment.
  *
@@ -601,6 +678,9 @@ CreateAnonymousSegment(Size *size)
 	Size		allocsize = *size;
 	void	   *ptr = MAP_FAILED;
 	int			mmap_errno = 0;
+#ifdef MAP_HUGETLB
+	Size		hugesize = 0;
+#endif
 
 #ifndef MAP_HUGETLB
 	/* PGSharedMemoryCreate should have dealt with this case */
@@ -622,9 +702,30 @@ CreateAnonymousSegment(Size *size)
 		ptr = mmap(NULL, allocsize, PROT_READ | PROT_WRITE,
 				   PG_MMAP_FLAGS | mmap_flags, -1, 0);
 		mmap_errno = errno;
+		if (ptr != MAP_FAILED)
+			hugesize = allocsize;
+
+		/*
+		 * If the pool can't cover the whole segment, fall back to backing
+		 * just the start of the segment with whatever huge pages are
+		 * available, rather than giving up on them entirely.
+		 */
 		if (huge_pages == HUGE_PAGES_TRY && ptr == MAP_FAILED)
-			elog(DEBUG1, "mmap(%zu) with MAP_HUGETLB failed, huge pages disabled: %m",
+		{
+			elog(DEBUG1, "mmap(%zu) with MAP_HUGETLB failed, trying partial huge page backing: %m",
 				 allocsize);
+
+			allocsize = *size;
+			ptr = CreateHybridSegment(allocsize, hugepagesize, mmap_flags,
+									  &hugesize);
+			mmap_errno = errno;
+			if (ptr == MAP_FAILED)
+				elog(DEBUG1, "partial huge page mmap(%zu) failed, huge pages disabled: %m",
+					 allocsize);
+			else
+				elog(DEBUG1, "mapped %zu of %zu bytes of shared memory with huge pages",
+					 hugesize, allocsize);
+		}
 	}
 #endif
 
@@ -633,8 +734,14 @@ CreateAnonymousSegment(Size *size)
 	 * the second mmap() call if attempting to use huge pages failed
 	 * previously.
 	 */
-	SetConfigOption("huge_pages_status", (ptr == MAP_FAILED) ? "off" : "on",
-					PGC_INTERNAL, PGC_S_DYNAMIC_DEFAULT);
+#ifdef MAP_HUGETLB
+	if (ptr != MAP_FAILED && hugesize > 0 && hugesize < allocsize)
+		SetConfigOption("huge_pages_status", "partial",
+						PGC_INTERNAL, PGC_S_DYNAMIC_DEFAULT);
+	else
+#endif
+		SetConfigOption("huge_pages_status", (ptr == MAP_FAILED) ? "off" : "on",
+						PGC_INTERNAL, PGC_S_DYNAMIC_DEFAULT);
 
 	if (ptr == MAP_FAILED && huge_pages != HUGE_PAGES_ON)
 	{
@@ -196,6 +196,14 @@ typedef struct av_relation
 								 * reloptions, or NULL if none */
 } av_relation;
 
+/* struct representing one table to vacuum/analyze, with its urgency score */
+typedef struct avw_table
+{
+	Oid			aw_relid;
+	bool		aw_wraparound;	/* is vacuum forced for wraparound? */
+	float4		aw_score;		/* urgency within its wraparound class */
+} avw_table;
+
 /* struct to keep track of tables to vacuum and/or analyze, after rechecking */
 typedef struct autovac_table
 {
@@ -335,6 +343,7 @@ static void launch_worker(TimestampTz now);
 static List *get_database_list(void);
 static void rebuild_database_list(Oid newdb);
 static int	db_comparator(const void *a, const void *b);
+static int	table_priority_comparator(const ListCell *a, const ListCell *b);
 static void autovac_recalculate_workers_for_balance(void);
 
 static void do_autovacuum(void);
@@ -351,7 +360,8 @@ static void relation_needs_vacanalyze(Oid relid, AutoVacOpts *relopts,
 									  Form_pg_class classForm,
 									  PgStat_StatTabEntry *tabentry,
 									  int effective_multixact_freeze_max_age,
-									  bool *dovacuum, bool *doanalyze, bool *wraparound);
+									  bool *dovacuum, bool *doanalyze,
+									  bool *wraparound, float4 *score);
 
 static void autovacuum_do_vac_analyze(autovac_table *tab,
 									  BufferAccessStrategy bstrategy);
@@ -1081,6 +1091,21 @@ rebuild_database_list(Oid newdb)
 	MemoryContextSwitchTo(oldcxt);
 }
 
+/* list_sort comparator for avw_table entries, most urgent table first */
+static int
+table_priority_comparator(const ListCell *a, const ListCell *b)
+{
+	const avw_table *taba = lfirst(a);
+	const avw_table *tabb = lfirst(b);
+
+	/* anti-wraparound work always sorts first */
+	if (taba->aw_wraparound != tabb->aw_wraparound)
+		return taba->aw_wraparound ? -1 : 1;
+	if (taba->aw_score != tabb->aw_score)
+		return (taba->aw_score > tabb->aw_score) ? -1 : 1;
+	return 0;
+}
+
 /* qsort comparator for avl_dbase, using adl_score */
 static int
 db_comparator(const void *a, const void *b)
@@ -2014,6 +2039,7 @@ do_autovacuum(void)
 		bool		dovacuum;
 		bool		doanalyze;
 		bool		wraparound;
+		float4		score;
 
 		if (classForm->relkind != RELKIND_RELATION &&
 			classForm->relkind != RELKIND_MATVIEW)
@@ -2054,11 +2080,18 @@ do_autovacuum(void)
 		/* Check if it needs vacuum or analyze */
 		relation_needs_vacanalyze(relid, relopts, classForm, tabentry,
 								  effective_multixact_freeze_max_age,
-								  &dovacuum, &doanalyze, &wraparound);
+								  &dovacuum, &doanalyze, &wraparound, &score);
 
 		/* Relations that need work are added to table_oids */
 		if (dovacuum || doanalyze)
-			table_oids = lappend_oid(table_oids, relid);
+		{
+			avw_table  *avtab = palloc(sizeof(avw_table));
+
+			avtab->aw_relid = relid;
+			avtab->aw_wraparound = wraparound;
+			avtab->aw_score = score;
+			table_oids = lappend(table_oids, avtab);
+		}
 
 		/*
 		 * Remember TOAST associations for the second pass.  Note: we must do
@@ -2114,6 +2147,7 @@ do_autovacuum(void)
 		bool		dovacuum;
 		bool		doanalyze;
 		bool		wraparound;
+		float4		score;
 
 		/*
 		 * We cannot safely process other backends' temp tables, so skip 'em.
@@ -2146,11 +2180,18 @@ do_autovacuum(void)
 
 		relation_needs_vacanalyze(relid, relopts, classForm, tabentry,
 								  effective_multixact_freeze_max_age,
-								  &dovacuum, &doanalyze, &wraparound);
+								  &dovacuum, &doanalyze, &wraparound, &score);
 
 		/* ignore analyze for toast tables */
 		if (dovacuum)
-			table_oids = lappend_oid(table_oids, relid);
+		{
+			avw_table  *avtab = palloc(sizeof(avw_table));
+
+			avtab->aw_relid = relid;
+			avtab->aw_wraparound = wraparound;
+			avtab->aw_score = score;
+			table_oids = lappend(table_oids, avtab);
+		}
 
 		/* Release stuff to avoid leakage */
 		if (free_relopts)
@@ -2162,6 +2203,15 @@ do_autovacuum(void)
 	table_endscan(relScan);
 	table_close(classRel, AccessShareLock);
 
+	/*
+	 * Process the most urgent tables first: anti-wraparound work before
+	 * anything else, and within each class, highest score first.  This keeps
+	 * a long-running vacuum of some huge cold table from starving tables
+	 * that are bloating quickly or nearing xidStopLimit: by the time we get
+	 * around to the cold table, the urgent ones have been dealt with.
+	 */
+	list_sort(table_oids, table_priority_comparator);
+
 	/*
 	 * Recheck orphan temporary tables, and if they still seem orphaned, drop
 	 * them.  We'll eat a transaction per dropped table, which might seem
@@ -2304,7 +2354,8 @@ do_autovacuum(void)
 	 */
 	foreach(cell, table_oids)
 	{
-		Oid			relid = lfirst_oid(cell);
+		avw_table  *avtab = lfirst(cell);
+		Oid			relid = avtab->aw_relid;
 		HeapTuple	classTup;
 		autovac_table *tab;
 		bool		isshared;
@@ -2535,7 +2586,7 @@ deleted:
 		pg_atomic_test_set_flag(&MyWorkerInfo->wi_dobalance);
 	}
 
-	list_free(table_oids);
+	list_free_deep(table_oids);
 
 	/*
 	 * Perform additional work items, as requested by backends.
@@ -2677,6 +2728,10 @@ perform_work_item(AutoVacuumWorkItem *workitem)
 									ObjectIdGetDatum(workitem->avw_relation),
 									Int64GetDatum((int64) workitem->avw_blockNumber));
 				break;
+			case AVW_GinCleanPendingList:
+				DirectFunctionCall1(gin_clean_pending_list,
+									ObjectIdGetDatum(workitem->avw_relation));
+				break;
 			default:
 				elog(WARNING, "unrecognized work item found: type %d",
 					 workitem->avw_type);
@@ -2937,6 +2992,7 @@ recheck_relation_needs_vacanalyze(Oid relid,
 								  bool *wraparound)
 {
 	PgStat_StatTabEntry *tabentry;
+	float4		score;
 
 	/* fetch the pgstat table entry */
 	tabentry = pgstat_fetch_stat_tabentry_ext(classForm->relisshared,
@@ -2944,7 +3000,7 @@ recheck_relation_needs_vacanalyze(Oid relid,
 
 	relation_needs_vacanalyze(relid, avopts, classForm, tabentry,
 							  effective_multixact_freeze_max_age,
-							  dovacuum, doanalyze, wraparound);
+							  dovacuum, doanalyze, wraparound, &score);
 
 	/* Release tabentry to avoid leakage */
 	if (tabentry)
@@ -3003,7 +3059,8 @@ relation_needs_vacanalyze(Oid relid,
  /* output params below */
 						  bool *dovacuum,
 						  bool *doanalyze,
-						  bool *wraparound)
+						  bool *wraparound,
+						  float4 *score)
 {
 	bool		force_vacuum;
 	bool		av_enabled;
@@ -3037,6 +3094,8 @@ relation_needs_vacanalyze(Oid relid,
 	Assert(classForm != NULL);
 	Assert(OidIsValid(relid));
 
+	*score = 0;
+
 	/*
 	 * Determine vacuum/analyze equation parameters.  We have two possible
 	 * sources: the passed reloptions (which could be a main table or a toast
@@ -3103,6 +3162,21 @@ relation_needs_vacanalyze(Oid relid,
 	}
 	*wraparound = force_vacuum;
 
+	/*
+	 * Score anti-wraparound vacuums by the age of whichever of relfrozenxid
+	 * and relminmxid tripped its force limit, so that the tables closest to
+	 * xidStopLimit are processed first.  Tables not at risk are scored
+	 * further down by how far past their thresholds they are.
+	 */
+	if (force_vacuum)
+	{
+		if (TransactionIdIsNormal(relfrozenxid))
+			*score = (float4) (recentXid - relfrozenxid);
+		if (MultiXactIdIsValid(classForm->relminmxid))
+			*score = Max(*score,
+						 (float4) (recentMulti - classForm->relminmxid));
+	}
+
 	/* User disabled it in pg_class.reloptions?  (But ignore if at risk) */
 	if (!av_enabled && !force_vacuum)
 	{
@@ -3171,6 +3245,17 @@ relation_needs_vacanalyze(Oid relid,
 		*dovacuum = force_vacuum || (vactuples > vacthresh) ||
 			(vac_ins_base_thresh >= 0 && instuples > vacinsthresh);
 		*doanalyze = (anltuples > anlthresh);
+
+		/* Score ordinary work by how far past its thresholds the table is */
+		if (!force_vacuum)
+		{
+			if (vacthresh > 0)
+				*score = vactuples / vacthresh;
+			if (vac_ins_base_thresh >= 0 && vacinsthresh > 0)
+				*score = Max(*score, instuples / vacinsthresh);
+			if (anlthresh > 0)
+				*score = Max(*score, anltuples / anlthresh);
+		}
 	}
 	else
 	{
@@ -3284,6 +3369,10 @@ autovac_report_workitem(AutoVacuumWorkItem *workitem,
 			snprintf(activity, MAX_AUTOVAC_ACTIV_LEN,
 					 "autovacuum: BRIN summarize");
 			break;
+		case AVW_GinCleanPendingList:
+			snprintf(activity, MAX_AUTOVAC_ACTIV_LEN,
+					 "autovacuum: GIN pending list cleanup");
+			break;
 	}
 
 	/*
@@ -3331,6 +3420,27 @@ AutoVacuumRequestWork(AutoVacuumWorkItemType type, Oid relationId,
 
 	LWLockAcquire(AutovacuumLock, LW_EXCLUSIVE);
 
+	/*
+	 * If an identical request is already queued and not yet being worked on,
+	 * don't add another; report it as recorded.  This keeps repeated
+	 * requests for the same work (such as GIN pending-list cleanup fired on
+	 * every insertion past the threshold) from flooding the list.
+	 */
+	for (i = 0; i < NUM_WORKITEMS; i++)
+	{
+		AutoVacuumWorkItem *workitem = &AutoVacuumShmem->av_workItems[i];
+
+		if (workitem->avw_used && !workitem->avw_active &&
+			workitem->avw_type == type &&
+			workitem->avw_database == MyDatabaseId &&
+			workitem->avw_relation == relationId &&
+			workitem->avw_blockNumber == blkno)
+		{
+			LWLockRelease(AutovacuumLock);
+			return true;
+		}
+	}
+
 	/*
 	 * Locate an unused work item and fill it with the given data.
 	 */
@@ -1049,10 +1049,36 @@ bool
 RegisterDynamicBackgroundWorker(BackgroundWorker *worker,
 								BackgroundWorkerHandle **handle)
 {
-	int			slotno;
-	bool		success = false;
-	bool		parallel;
-	uint64		generation = 0;
+	return RegisterDynamicBackgroundWorkers(worker, 1, handle) == 1;
+}
+
+/*
+ * Register a batch of new background workers from a regular backend.
+ *
+ * This is like calling RegisterDynamicBackgroundWorker once per element of
+ * workers[], but it grabs all the slots while holding BackgroundWorkerLock
+ * just once and notifies the postmaster with a single signal, so the
+ * postmaster can start the whole batch in one pass over its worker list.
+ * That keeps registration overhead flat when a parallel query launches
+ * several workers at once.
+ *
+ * Returns the number of workers successfully registered.  Workers are
+ * registered in array order, so on a short return the first workers are the
+ * ones that got slots; registration stops at the first failure, since the
+ * remaining attempts would run into the same limit.
+ *
+ * If handles != NULL, handles[i] is set for each registered worker, with the
+ * same semantics as RegisterDynamicBackgroundWorker's handle output.
+ */
+int
+RegisterDynamicBackgroundWorkers(BackgroundWorker *workers, int nworkers,
+								 BackgroundWorkerHandle **handles)
+{
+	int			nregistered = 0;
+	int			slotno = 0;
+	int			i;
+	int		   *slotnos;
+	uint64	   *generations;
 
 	/*
 	 * We can't register dynamic background workers from the postmaster. If
@@ -1063,81 +1089,108 @@ RegisterDynamicBackgroundWorker(BackgroundWorker *worker,
 	 * structure.
 	 */
 	if (!IsUnderPostmaster)
-		return false;
+		return 0;
 
-	if (!SanityCheckBackgroundWorker(worker, ERROR))
-		return false;
+	for (i = 0; i < nworkers; ++i)
+	{
+		if (!SanityCheckBackgroundWorker(&workers[i], ERROR))
+			return 0;
+	}
 
-	parallel = (worker->bgw_flags & BGWORKER_CLASS_PARALLEL) != 0;
+	slotnos = palloc(nworkers * sizeof(int));
+	generations = palloc(nworkers * sizeof(uint64));
 
 	LWLockAcquire(BackgroundWorkerLock, LW_EXCLUSIVE);
 
-	/*
-	 * If this is a parallel worker, check whether there are already too many
-	 * parallel workers; if so, don't register another one.  Our view of
-	 * parallel_terminate_count may be slightly stale, but that doesn't really
-	 * matter: we would have gotten the same result if we'd arrived here
-	 * slightly earlier anyway.  There's no help for it, either, since the
-	 * postmaster must not take locks; a memory barrier wouldn't guarantee
-	 * anything useful.
-	 */
-	if (parallel && (BackgroundWorkerData->parallel_register_count -
-					 BackgroundWorkerData->parallel_terminate_count) >=
-		max_parallel_workers)
+	for (i = 0; i < nworkers; ++i)
 	{
-		Assert(BackgroundWorkerData->parallel_register_count -
-			   BackgroundWorkerData->parallel_terminate_count <=
-			   MAX_PARALLEL_WORKER_LIMIT);
-		LWLockRelease(BackgroundWorkerLock);
-		return false;
-	}
+		BackgroundWorker *worker = &workers[i];
+		bool		parallel;
+		bool		found = false;
 
-	/*
-	 * Look for an unused slot.  If we find one, grab it.
-	 */
-	for (slotno = 0; slotno < BackgroundWorkerData->total_slots; ++slotno)
-	{
-		BackgroundWorkerSlot *slot = &BackgroundWorkerData->slot[slotno];
+		parallel = (worker->bgw_flags & BGWORKER_CLASS_PARALLEL) != 0;
 
-		if (!slot->in_use)
+		/*
+		 * If this is a parallel worker, check whether there are already too
+		 * many parallel workers; if so, don't register another one.  Our
+		 * view of parallel_terminate_count may be slightly stale, but that
+		 * doesn't really matter: we would have gotten the same result if
+		 * we'd arrived here slightly earlier anyway.  There's no help for
+		 * it, either, since the postmaster must not take locks; a memory
+		 * barrier wouldn't guarantee anything useful.
+		 */
+		if (parallel && (BackgroundWorkerData->parallel_register_count -
+						 BackgroundWorkerData->parallel_terminate_count) >=
+			max_parallel_workers)
 		{
-			memcpy(&slot->worker, worker, sizeof(BackgroundWorker));
-			slot->pid = InvalidPid; /* indicates not started yet */
-			slot->generation++;
-			slot->terminate = false;
-			generation = slot->generation;
-			if (parallel)
-				BackgroundWorkerData->parallel_register_count++;
+			Assert(BackgroundWorkerData->parallel_register_count -
+				   BackgroundWorkerData->parallel_terminate_count <=
+				   MAX_PARALLEL_WORKER_LIMIT);
+			break;
+		}
 
-			/*
-			 * Make sure postmaster doesn't see the slot as in use before it
-			 * sees the new contents.
-			 */
-			pg_write_barrier();
+		/*
+		 * Look for an unused slot.  If we find one, grab it.  Slots already
+		 * claimed for earlier workers of this batch can't have been freed
+		 * while we hold the lock, so the scan resumes where it left off.
+		 */
+		for (; slotno < BackgroundWorkerData->total_slots; ++slotno)
+		{
+			BackgroundWorkerSlot *slot = &BackgroundWorkerData->slot[slotno];
 
-			slot->in_use = true;
-			success = true;
-			break;
+			if (!slot->in_use)
+			{
+				memcpy(&slot->worker, worker, sizeof(BackgroundWorker));
+				slot->pid = InvalidPid; /* indicates not started yet */
+				slot->generation++;
+				slot->terminate = false;
+				slotnos[i] = slotno;
+				generations[i] = slot->generation;
+				if (parallel)
+					BackgroundWorkerData->parallel_register_count++;
+
+				/*
+				 * Make sure postmaster doesn't see the slot as in use before
+				 * it sees the new contents.
+				 */
+				pg_write_barrier();
+
+				slot->in_use = true;
+				found = true;
+				++slotno;
+				break;
+			}
 		}
+
+		if (!found)
+			break;
+		nregistered++;
 	}
 
 	LWLockRelease(BackgroundWorkerLock);
 
-	/* If we found a slot, tell the postmaster to notice the change. */
-	if (success)
+	/* If we found any slots, tell the postmaster to notice the change. */
+	if (nregistered > 0)
 		SendPostmasterSignal(PMSIGNAL_BACKGROUND_WORKER_CHANGE);
 
 	/*
-	 * If we found a slot and the user has provided a handle, initialize it.
+	 * If the user has provided handles, initialize one per registered
+	 * worker.
 	 */
-	if (success && handle)
+	if (handles)
 	{
-		*handle = palloc(sizeof(BackgroundWorkerHandle));
-		(*handle)->slot = slotno;
-		(*handle)->generation = generation;
+		for (i = 0; i < nregistered; ++i)
+		{
+			handles[i] = palloc(sizeof(BackgroundWorkerHandle));
+			handles[i]->slot = slotnos[i];
+			handles[i]->generation = generations[i];
+		}
 	}
 
-	return success;
+	pfree(slotnos);
+	pfree(generations);
+
+	return nregistered;
 }
 
 /*
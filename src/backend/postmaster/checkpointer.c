@@ -1212,6 +1212,18 @@ RequestCheckpoint(int flags)
  * is theoretically possible a backend fsync might still be necessary, if
  * the queue is full and contains no duplicate entries.  In that case, we
  * let the backend know by returning false.
+ *
+ * A lock-free multi-producer queue with per-backend batching has been
+ * suggested for bulk-load workloads that fill the queue.  The lock is not
+ * really the pain point — the critical section is an array store — and a
+ * lock-free ring would foreclose exactly the operation that relieves the
+ * pressure: compaction requires scanning and rewriting the whole queue in
+ * place, which needs mutual exclusion.  Batching requests in backend-local
+ * memory also delays their visibility to the checkpointer, widening the
+ * window where a crash loses track of a dirty segment unless the local
+ * batch is flushed at every XLogFlush-like boundary, at which point little
+ * batching remains.  The productive knob is queue capacity, which scales
+ * with NBuffers.
  */
 bool
 ForwardSyncRequest(const FileTag *ftag, SyncRequestType type)
@@ -19,6 +19,20 @@
  * global variables, reload the config file etc. to get the process to the
  * same state as after fork() on a Unix system.
  *
+ * A recurring proposal is to keep pools of pre-warmed backends that have
+ * already run InitPostgres for a given database, parked until the postmaster
+ * hands them an incoming socket.  That does not fit the current process
+ * model: a backend's user identity, authentication, and GUC environment are
+ * established during startup and cannot be swapped afterwards, the
+ * postmaster deliberately touches no shared memory (so it cannot manage
+ * per-database pools without taking on state it must survive corruption of),
+ * and parked backends would pin relcache/catcache contents that DDL in other
+ * sessions expects to invalidate via sinval before any snapshot exists to
+ * process it.  The supported answers to connection-storm latency are
+ * external pooling and the relcache init file, which already short-circuits
+ * most of the catalog warmup that makes the first connection to a database
+ * expensive.
+ *
  *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -120,6 +120,20 @@ static MemoryContext archive_context;
  *
  * We only need this data in the archiver process, so make it a palloc'd
  * struct rather than a bunch of static arrays.
+ *
+ * Note that while we batch the *discovery* of ready files this way, each
+ * file is still handed to the archive module (or archive_command) on its
+ * own, in order.  The serialization is part of the contract: a segment's
+ * .ready marker is durably renamed to .done only after its archive
+ * callback reports success, so a failure stops exactly at the oldest
+ * unarchived segment and retrying is idempotent.  Archiving N segments
+ * concurrently would need per-segment completion tracking that preserves
+ * that property when segment K fails but K+1 succeeded, across archiver
+ * restarts, for both archive_command and module implementations.  Modules
+ * that want to amortize per-file costs (connection setup, TLS handshakes)
+ * can do so today by keeping state in their ArchiveModuleState across
+ * archive_file_cb calls; the callback sequence is a stream, not isolated
+ * invocations.
  */
 struct arch_files_state
 {
@@ -252,6 +252,13 @@ WalWriterMain(const void *startup_data, size_t startup_data_len)
 		else if (left_till_hibernate > 0)
 			left_till_hibernate--;
 
+		/*
+		 * Keep a few future WAL segments pre-created, so that foreground
+		 * processes crossing a segment boundary don't have to zero-fill a
+		 * new segment inline.
+		 */
+		XLogBackgroundPrealloc();
+
 		/* report pending statistics to the cumulative stats system */
 		pgstat_report_wal(false);
 
@@ -583,8 +583,12 @@ libpqrcv_startstreaming(WalReceiverConn *conn,
 		appendStringInfoChar(&cmd, ')');
 	}
 	else
+	{
 		appendStringInfo(&cmd, " TIMELINE %u",
 						 options->proto.physical.startpointTLI);
+		if (options->proto.physical.compression)
+			appendStringInfoString(&cmd, " COMPRESSION 'lz4'");
+	}
 
 	/* Start streaming. */
 	res = libpqsrv_exec(conn->streamConn,
@@ -43,6 +43,18 @@
  * XXX This worker pool threshold is arbitrary and we can provide a GUC
  * variable for this in the future if required.
  *
+ * XXX A natural-looking extension of this pool is to also dispatch small,
+ * already-committed transactions to parallel workers, relaxing the
+ * wait-at-commit rule for transactions whose row sets don't overlap.  That
+ * can't be done with the information currently available on the subscriber:
+ * changes carry replica identity values, but detecting overlap would require
+ * tracking every (relation, key) touched by each in-flight transaction, and
+ * point (a) above applies to dependencies the publisher saw but we can't see
+ * here (e.g. through triggers or foreign keys on the subscriber side).
+ * Safely relaxing commit ordering therefore needs dependency metadata
+ * computed on the publisher and shipped through the protocol, not just a
+ * subscriber-side change.
+ *
  * The leader apply worker will create a separate dynamic shared memory segment
  * when each parallel apply worker starts. The reason for this design is that
  * we cannot predict how many workers will be needed. It may be possible to
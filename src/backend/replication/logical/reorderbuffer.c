@@ -47,7 +47,12 @@
  *	  ReorderBuffer uses two special memory context types - SlabContext for
  *	  allocations of fixed-length structures (changes and transactions), and
  *	  GenerationContext for the variable-length transaction data (allocated
- *	  and freed in groups with similar lifespans).
+ *	  and freed in groups with similar lifespans).  Between them these cover
+ *	  the allocation churn of decoding: freed changes go back on the slab
+ *	  freelists for reuse, and tuple buffers for one transaction tend to be
+ *	  laid out together in generation blocks that are returned to the OS
+ *	  wholesale when the transaction's changes are freed at commit or abort,
+ *	  so no per-chunk freelist maintenance is done for them at all.
  *
  *	  To limit the amount of memory used by decoded changes, we track memory
  *	  used at the reorder buffer level (i.e. total amount of memory), and for
@@ -88,6 +93,9 @@
 
 #include <unistd.h>
 #include <sys/stat.h>
+#ifdef USE_LZ4
+#include <lz4.h>
+#endif
 
 #include "access/detoast.h"
 #include "access/heapam.h"
@@ -189,11 +197,20 @@ typedef struct ReorderBufferToastEnt
 /* Disk serialization support datastructures */
 typedef struct ReorderBufferDiskChange
 {
-	Size		size;
+	Size		size;			/* on-disk size of this record */
+	Size		rawsize;		/* uncompressed size of the data portion, or
+								 * 0 if it is stored uncompressed */
 	ReorderBufferChange change;
 	/* data follows */
 } ReorderBufferDiskChange;
 
+/*
+ * Minimum size of a change's data portion before we bother trying to
+ * compress it on the way to disk.  Smaller changes rarely compress well
+ * enough to pay for the call overhead.
+ */
+#define REORDER_BUFFER_COMPRESS_THRESHOLD	256
+
 #define IsSpecInsert(action) \
 ( \
 	((action) == REORDER_BUFFER_CHANGE_INTERNAL_SPEC_INSERT) \
@@ -379,6 +396,8 @@ ReorderBufferAllocate(void)
 
 	buffer->outbuf = NULL;
 	buffer->outbufsize = 0;
+	buffer->compbuf = NULL;
+	buffer->compbufsize = 0;
 	buffer->size = 0;
 
 	/* txn_heap is ordered by transaction size */
@@ -3786,6 +3805,26 @@ ReorderBufferSerializeReserve(ReorderBuffer *rb, Size sz)
 	}
 }
 
+#ifdef USE_LZ4
+/*
+ * Ensure the compression scratch buffer is >= sz.
+ */
+static void
+ReorderBufferCompressReserve(ReorderBuffer *rb, Size sz)
+{
+	if (!rb->compbufsize)
+	{
+		rb->compbuf = MemoryContextAlloc(rb->context, sz);
+		rb->compbufsize = sz;
+	}
+	else if (rb->compbufsize < sz)
+	{
+		rb->compbuf = repalloc(rb->compbuf, sz);
+		rb->compbufsize = sz;
+	}
+}
+#endif
+
 
 /* Compare two transactions by size */
 static int
@@ -4273,6 +4312,49 @@ ReorderBufferSerializeChange(ReorderBuffer *rb, ReorderBufferTXN *txn,
 	}
 
 	ondisk->size = sz;
+	ondisk->rawsize = 0;
+
+#ifdef USE_LZ4
+	/*
+	 * Compress the data portion of large changes.  Spill files never
+	 * survive the ReorderBuffer that wrote them, so the format only needs
+	 * to record the uncompressed size alongside.
+	 */
+	if (sz - sizeof(ReorderBufferDiskChange) >= REORDER_BUFFER_COMPRESS_THRESHOLD)
+	{
+		Size		datasz = sz - sizeof(ReorderBufferDiskChange);
+		int			bound = LZ4_compressBound(datasz);
+		int			compsz;
+
+		ReorderBufferCompressReserve(rb, sizeof(ReorderBufferDiskChange) + bound);
+		compsz = LZ4_compress_default(rb->outbuf + sizeof(ReorderBufferDiskChange),
+									  rb->compbuf + sizeof(ReorderBufferDiskChange),
+									  datasz, bound);
+
+		/* only use the result if it actually saved something */
+		if (compsz > 0 && (Size) compsz < datasz)
+		{
+			ondisk->rawsize = datasz;
+			ondisk->size = sizeof(ReorderBufferDiskChange) + compsz;
+			memcpy(rb->compbuf, rb->outbuf, sizeof(ReorderBufferDiskChange));
+
+			/*
+			 * Write out the compressed copy instead of the original, by
+			 * temporarily adopting the scratch buffer as the IO buffer.
+			 */
+			{
+				char	   *swapbuf = rb->outbuf;
+				Size		swapsize = rb->outbufsize;
+
+				rb->outbuf = rb->compbuf;
+				rb->outbufsize = rb->compbufsize;
+				rb->compbuf = swapbuf;
+				rb->compbufsize = swapsize;
+			}
+			ondisk = (ReorderBufferDiskChange *) rb->outbuf;
+		}
+	}
+#endif
 
 	errno = 0;
 	pgstat_report_wait_start(WAIT_EVENT_REORDER_BUFFER_WRITE);
@@ -4667,6 +4749,43 @@ ReorderBufferRestoreChanges(ReorderBuffer *rb, ReorderBufferTXN *txn,
 
 		file->curOffset += readBytes;
 
+		/* decompress the data portion, if it was spilled compressed */
+		if (ondisk->rawsize != 0)
+		{
+#ifdef USE_LZ4
+			Size		rawsize = ondisk->rawsize;
+			char	   *swapbuf;
+			Size		swapsize;
+
+			ReorderBufferCompressReserve(rb,
+										 sizeof(ReorderBufferDiskChange) + rawsize);
+			if (LZ4_decompress_safe(rb->outbuf + sizeof(ReorderBufferDiskChange),
+									rb->compbuf + sizeof(ReorderBufferDiskChange),
+									ondisk->size - sizeof(ReorderBufferDiskChange),
+									rawsize) != (int) rawsize)
+				ereport(ERROR,
+						(errcode(ERRCODE_DATA_CORRUPTED),
+						 errmsg_internal("could not decompress change from reorderbuffer spill file")));
+			memcpy(rb->compbuf, rb->outbuf, sizeof(ReorderBufferDiskChange));
+
+			/* adopt the decompressed copy as the IO buffer */
+			swapbuf = rb->outbuf;
+			swapsize = rb->outbufsize;
+			rb->outbuf = rb->compbuf;
+			rb->outbufsize = rb->compbufsize;
+			rb->compbuf = swapbuf;
+			rb->compbufsize = swapsize;
+
+			ondisk = (ReorderBufferDiskChange *) rb->outbuf;
+			ondisk->size = sizeof(ReorderBufferDiskChange) + rawsize;
+			ondisk->rawsize = 0;
+#else
+			ereport(ERROR,
+					(errcode(ERRCODE_DATA_CORRUPTED),
+					 errmsg_internal("reorderbuffer spill file contains compressed data but the server was built without lz4 support")));
+#endif
+		}
+
 		/*
 		 * ok, read a full change from disk, now restore it into proper
 		 * in-memory format
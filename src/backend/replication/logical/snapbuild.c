@@ -424,6 +424,7 @@ SnapBuildBuildSnapshot(SnapBuild *builder)
 	snapshot->curcid = FirstCommandId;
 	snapshot->active_count = 0;
 	snapshot->regd_count = 0;
+	snapshot->last_lookup_xid = InvalidTransactionId;
 	snapshot->snapXactCompletionCount = 0;
 
 	return snapshot;
@@ -1233,6 +1234,17 @@ SnapBuildProcessRunningXacts(SnapBuild *builder, XLogRecPtr lsn, xl_running_xact
  *
  * Returns true if there is a point in performing internal maintenance/cleanup
  * using the xl_running_xacts record.
+ *
+ * On the cost of re-reaching consistency: when the goal is only slot
+ * advancement, decoding already runs in fast_forward mode (see decode.c),
+ * which skips queueing data changes, so the WAL re-read after a restart is
+ * not paying reorder-buffer costs — it is bounded by the restart_lsn,
+ * which SnapBuildProcessRunningXacts advances past long transactions as
+ * they finish.  Snapshots are likewise already serialized at every
+ * serializable xl_running_xacts record (path b above), and those arrive on
+ * the bgwriter's LOG_SNAPSHOT_INTERVAL_MS cadence regardless of WAL
+ * velocity; serializing more often than the records appear is not possible
+ * since they are the only safe serialization points.
  */
 static bool
 SnapBuildFindSnapshot(SnapBuild *builder, XLogRecPtr lsn, xl_running_xacts *running)
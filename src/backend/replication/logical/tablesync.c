@@ -1038,6 +1038,19 @@ fetch_remote_table_info(char *nspname, char *relname, LogicalRepRelation *lrel,
  * Copy existing data of a table from publisher.
  *
  * Caller is responsible for locking the local relation.
+ *
+ * Each table is copied by exactly one tablesync worker in a single COPY.
+ * The per-row costs are already addressed elsewhere: binary transfer is
+ * used when the subscription's binary option is set (see make_copy_data_cmd
+ * above), and CopyFrom on the apply side switches to multi-inserts when the
+ * target has no triggers or volatile defaults.  Splitting one large table
+ * across several workers by ctid range would additionally require each
+ * chunk to be read under the same publisher snapshot and all chunks to
+ * finish before this table's slot position is established — i.e. a shared
+ * snapshot and a completion barrier across tablesync slots for a single
+ * pg_subscription_rel entry.  Until the sync protocol grows that, the
+ * available parallelism is across tables via max_sync_workers_per_
+ * subscription.
  */
 static void
 copy_table(Relation rel)
@@ -70,6 +70,7 @@
 %token K_TIMELINE_HISTORY
 %token K_WAIT
 %token K_TIMELINE
+%token K_COMPRESSION
 %token K_PHYSICAL
 %token K_LOGICAL
 %token K_SLOT
@@ -89,6 +90,7 @@
 %type <list>	generic_option_list
 %type <defelt>	generic_option
 %type <uintval>	opt_timeline
+%type <str>		opt_compression
 %type <list>	plugin_options plugin_opt_list
 %type <defelt>	plugin_opt_elem
 %type <node>	plugin_opt_arg
@@ -282,7 +284,7 @@ alter_replication_slot:
  * START_REPLICATION [SLOT slot] [PHYSICAL] %X/%08X [TIMELINE %u]
  */
 start_replication:
-			K_START_REPLICATION opt_slot opt_physical RECPTR opt_timeline
+			K_START_REPLICATION opt_slot opt_physical RECPTR opt_timeline opt_compression
 				{
 					StartReplicationCmd *cmd;
 
@@ -291,6 +293,7 @@ start_replication:
 					cmd->slotname = $2;
 					cmd->startpoint = $4;
 					cmd->timeline = $5;
+					cmd->compression = $6;
 					$$ = (Node *) cmd;
 				}
 			;
@@ -366,6 +369,11 @@ opt_timeline:
 				| /* EMPTY */			{ $$ = 0; }
 			;
 
+opt_compression:
+			K_COMPRESSION SCONST	{ $$ = $2; }
+				| /* EMPTY */			{ $$ = NULL; }
+			;
+
 
 plugin_options:
 			'(' plugin_opt_list ')'			{ $$ = $2; }
@@ -433,6 +441,7 @@ ident_or_keyword:
 			| K_TIMELINE_HISTORY			{ $$ = "timeline_history"; }
 			| K_WAIT						{ $$ = "wait"; }
 			| K_TIMELINE					{ $$ = "timeline"; }
+			| K_COMPRESSION					{ $$ = "compression"; }
 			| K_PHYSICAL					{ $$ = "physical"; }
 			| K_LOGICAL						{ $$ = "logical"; }
 			| K_SLOT						{ $$ = "slot"; }
@@ -51,6 +51,10 @@
 
 #include <unistd.h>
 
+#ifdef USE_LZ4
+#include <lz4.h>
+#endif
+
 #include "access/htup_details.h"
 #include "access/timeline.h"
 #include "access/transam.h"
@@ -87,6 +91,7 @@
  */
 int			wal_receiver_status_interval;
 int			wal_receiver_timeout;
+bool		wal_receiver_compression = false;
 bool		hot_standby_feedback;
 
 /* libpqwalreceiver connection */
@@ -382,6 +387,14 @@ WalReceiverMain(const void *startup_data, size_t startup_data_len)
 		options.startpoint = startpoint;
 		options.slotname = slotname[0] != '\0' ? slotname : NULL;
 		options.proto.physical.startpointTLI = startpointTLI;
+#ifdef USE_LZ4
+		options.proto.physical.compression = wal_receiver_compression;
+#else
+		if (wal_receiver_compression)
+			ereport(WARNING,
+					(errmsg("\"wal_receiver_compression\" requires lz4 support, streaming without compression")));
+		options.proto.physical.compression = false;
+#endif
 		if (walrcv_startstreaming(wrconn, &options))
 		{
 			if (first_stream)
@@ -850,6 +863,67 @@ XLogWalRcvProcessMsg(unsigned char type, char *buf, Size len, TimeLineID tli)
 				XLogWalRcvWrite(buf, len, dataStart, tli);
 				break;
 			}
+		case PqReplMsg_CompressedWALData:
+			{
+#ifdef USE_LZ4
+				StringInfoData incoming_message;
+				static char *decompress_buf = NULL;
+				static int	decompress_buf_size = 0;
+				int			rawlen;
+				int			decomplen;
+
+				hdrlen = sizeof(int64) + sizeof(int64) + sizeof(int64) + sizeof(int32);
+				if (len < hdrlen)
+					ereport(ERROR,
+							(errcode(ERRCODE_PROTOCOL_VIOLATION),
+							 errmsg_internal("invalid compressed WAL message received from primary")));
+
+				/* initialize a StringInfo with the given buffer */
+				initReadOnlyStringInfo(&incoming_message, buf, hdrlen);
+
+				/* read the fields */
+				dataStart = pq_getmsgint64(&incoming_message);
+				walEnd = pq_getmsgint64(&incoming_message);
+				sendTime = pq_getmsgint64(&incoming_message);
+				rawlen = pq_getmsgint(&incoming_message, 4);
+				ProcessWalSndrMessage(walEnd, sendTime);
+
+				if (rawlen <= 0)
+					ereport(ERROR,
+							(errcode(ERRCODE_PROTOCOL_VIOLATION),
+							 errmsg_internal("invalid compressed WAL message received from primary")));
+
+				/*
+				 * The decompression buffer is kept across messages; the
+				 * sender never exceeds its internal send-chunk size, so it
+				 * quickly reaches a steady state.
+				 */
+				if (rawlen > decompress_buf_size)
+				{
+					if (decompress_buf != NULL)
+						pfree(decompress_buf);
+					decompress_buf = MemoryContextAlloc(TopMemoryContext, rawlen);
+					decompress_buf_size = rawlen;
+				}
+
+				buf += hdrlen;
+				len -= hdrlen;
+
+				decomplen = LZ4_decompress_safe(buf, decompress_buf,
+												len, rawlen);
+				if (decomplen != rawlen)
+					ereport(ERROR,
+							(errcode(ERRCODE_PROTOCOL_VIOLATION),
+							 errmsg_internal("could not decompress WAL message received from primary")));
+
+				XLogWalRcvWrite(decompress_buf, rawlen, dataStart, tli);
+#else
+				ereport(ERROR,
+						(errcode(ERRCODE_PROTOCOL_VIOLATION),
+						 errmsg_internal("compressed WAL message received but this build does not support compression")));
+#endif
+				break;
+			}
 		case PqReplMsg_Keepalive:
 			{
 				StringInfoData incoming_message;
@@ -1156,6 +1230,18 @@ XLogWalRcvSendReply(bool force, bool requestReply)
  * on first connect because a previous connection might have set xmin
  * on a replication slot. (If we're not using a slot it's harmless to
  * send a feedback message explicitly setting InvalidTransactionId).
+ *
+ * The feedback is deliberately a single pair of horizons for the whole
+ * standby, even though that holds back cleanup on every relation for the
+ * sake of whatever the standby's oldest snapshot might read.  Per-relation
+ * feedback has been suggested, but a snapshot is not scoped to relations:
+ * any standby query can reach arbitrary tables mid-flight (functions,
+ * dynamic SQL), so the standby cannot soundly promise the primary that a
+ * snapshot will never need a given relation's dead tuples.  The primary
+ * side would additionally need per-relation xmin tracking in shared memory
+ * of unbounded size.  Standbys that need long reports without bloating the
+ * primary should use a separate replica with delayed conflict settings
+ * (max_standby_streaming_delay) instead.
  */
 static void
 XLogWalRcvSendHSFeedback(bool immed)
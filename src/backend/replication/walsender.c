@@ -49,6 +49,10 @@
 #include <signal.h>
 #include <unistd.h>
 
+#ifdef USE_LZ4
+#include <lz4.h>
+#endif
+
 #include "access/timeline.h"
 #include "access/transam.h"
 #include "access/twophase.h"
@@ -80,6 +84,7 @@
 #include "replication/walsender.h"
 #include "replication/walsender_private.h"
 #include "storage/condition_variable.h"
+#include "storage/aio.h"
 #include "storage/aio_subsys.h"
 #include "storage/fd.h"
 #include "storage/ipc.h"
@@ -177,6 +182,15 @@ static StringInfoData output_message;
 static StringInfoData reply_message;
 static StringInfoData tmpbuf;
 
+#ifdef USE_LZ4
+/*
+ * Whether the standby negotiated lz4 compression of the physical WAL stream
+ * (START_REPLICATION ... COMPRESSION 'lz4').
+ */
+static bool wal_stream_compression = false;
+static StringInfoData compressed_message;
+#endif
+
 /* Timestamp of last ProcessRepliesIfAny(). */
 static TimestampTz last_processing = 0;
 
@@ -838,6 +852,31 @@ StartReplication(StartReplicationCmd *cmd)
 	 * written at wal_level='minimal'.
 	 */
 
+	/*
+	 * Establish what compression, if any, the standby asked for.  Refusing
+	 * an unsupported method here, before entering COPY mode, lets the
+	 * standby report a comprehensible error.
+	 */
+	if (cmd->compression != NULL)
+	{
+		if (pg_strcasecmp(cmd->compression, "lz4") == 0)
+		{
+#ifdef USE_LZ4
+			wal_stream_compression = true;
+#else
+			ereport(ERROR,
+					(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+					 errmsg("compression method \"%s\" not supported by this build",
+							cmd->compression)));
+#endif
+		}
+		else if (pg_strcasecmp(cmd->compression, "off") != 0)
+			ereport(ERROR,
+					(errcode(ERRCODE_SYNTAX_ERROR),
+					 errmsg("unrecognized compression method \"%s\"",
+							cmd->compression)));
+	}
+
 	if (cmd->slotname)
 	{
 		ReplicationSlotAcquire(cmd->slotname, true, true);
@@ -2116,6 +2155,9 @@ exec_replication_command(const char *cmd_string)
 	initStringInfo(&output_message);
 	initStringInfo(&reply_message);
 	initStringInfo(&tmpbuf);
+#ifdef USE_LZ4
+	initStringInfo(&compressed_message);
+#endif
 
 	switch (cmd_node->type)
 	{
@@ -3191,6 +3233,7 @@ XLogSendPhysical(void)
 	XLogSegNo	segno;
 	WALReadError errinfo;
 	Size		rbytes;
+	StringInfo	send_message;
 
 	/* If requested switch the WAL sender to the stopping state. */
 	if (got_STOPPING)
@@ -3456,15 +3499,53 @@ retry:
 	output_message.len += nbytes;
 	output_message.data[output_message.len] = '\0';
 
+	send_message = &output_message;
+
+#ifdef USE_LZ4
+	/*
+	 * If the standby negotiated stream compression, try to shrink the WAL
+	 * payload.  The compressed message carries the same header as a plain
+	 * WAL data message, followed by the uncompressed payload length and the
+	 * lz4 block.  Payloads that don't shrink (e.g. full-page images of
+	 * already-compressed data) are sent raw; the message type byte tells
+	 * the standby which form it got.
+	 */
+	if (wal_stream_compression)
+	{
+		int			hdrlen = 1 + sizeof(int64) + sizeof(int64) + sizeof(int64);
+		int			rawlen = output_message.len - hdrlen;
+		int			bound = LZ4_compressBound(rawlen);
+		int			complen;
+
+		resetStringInfo(&compressed_message);
+		pq_sendbyte(&compressed_message, PqReplMsg_CompressedWALData);
+		appendBinaryStringInfo(&compressed_message,
+							   &output_message.data[1], hdrlen - 1);
+		pq_sendint32(&compressed_message, rawlen);
+		enlargeStringInfo(&compressed_message, bound);
+
+		complen = LZ4_compress_default(&output_message.data[hdrlen],
+									   &compressed_message.data[compressed_message.len],
+									   rawlen, bound);
+		if (complen > 0 &&
+			compressed_message.len + complen < output_message.len)
+		{
+			compressed_message.len += complen;
+			compressed_message.data[compressed_message.len] = '\0';
+			send_message = &compressed_message;
+		}
+	}
+#endif
+
 	/*
 	 * Fill the send timestamp last, so that it is taken as late as possible.
 	 */
 	resetStringInfo(&tmpbuf);
 	pq_sendint64(&tmpbuf, GetCurrentTimestamp());
-	memcpy(&output_message.data[1 + sizeof(int64) + sizeof(int64)],
+	memcpy(&send_message->data[1 + sizeof(int64) + sizeof(int64)],
 		   tmpbuf.data, sizeof(int64));
 
-	pq_putmessage_noblock(PqMsg_CopyData, output_message.data, output_message.len);
+	pq_putmessage_noblock(PqMsg_CopyData, send_message->data, send_message->len);
 
 	sentPtr = endptr;
 
@@ -3852,11 +3933,21 @@ WalSndWait(uint32 socket_events, long timeout, uint32 wait_event)
 	else if (MyWalSnd->kind == REPLICATION_KIND_LOGICAL)
 		ConditionVariablePrepareToSleep(&WalSndCtl->wal_replay_cv);
 
-	if (WaitEventSetWait(FeBeWaitSet, timeout, &event, 1, wait_event) == 1 &&
-		(event.events & WL_POSTMASTER_DEATH))
+	if (WaitEventSetWait(FeBeWaitSet, timeout, &event, 1, wait_event) == 1)
 	{
-		ConditionVariableCancelSleep();
-		proc_exit(1);
+		if (event.events & WL_POSTMASTER_DEATH)
+		{
+			ConditionVariableCancelSleep();
+			proc_exit(1);
+		}
+
+		/*
+		 * Consume any ready AIO completions, lest the level-triggered
+		 * completion fd wake us again immediately.  (See
+		 * pq_add_aio_completion_event().)
+		 */
+		if (event.pos == FeBeWaitSetAioPos)
+			pgaio_process_completions();
 	}
 
 	ConditionVariableCancelSleep();
@@ -1147,6 +1147,37 @@ pgaio_submit_staged(void)
 				total_submitted);
 }
 
+/*
+ * Return a file descriptor that becomes readable when completions of IOs
+ * issued by this backend are waiting to be processed, or -1 if the active IO
+ * method cannot provide one.
+ *
+ * The fd may be added to a WaitEventSet (using WL_SOCKET_READABLE), so that a
+ * backend waiting for something else - typically the client socket - also
+ * wakes up when an IO completes.  It stays readable until the completions are
+ * processed, so wait sites watching it must call
+ * pgaio_process_completions() when it triggers.
+ */
+int
+pgaio_completion_fd(void)
+{
+	if (pgaio_method_ops->completion_fd)
+		return pgaio_method_ops->completion_fd();
+
+	return -1;
+}
+
+/*
+ * Process any IO completions that are ready for this backend, without
+ * blocking.  A no-op for IO methods that process completions elsewhere.
+ */
+void
+pgaio_process_completions(void)
+{
+	if (pgaio_method_ops->process_completions)
+		pgaio_method_ops->process_completions();
+}
+
 
 
 /* --------------------------------------------------------------------------------
@@ -54,6 +54,8 @@ static void pgaio_uring_shmem_init(bool first_time);
 static void pgaio_uring_init_backend(void);
 static int	pgaio_uring_submit(uint16 num_staged_ios, PgAioHandle **staged_ios);
 static void pgaio_uring_wait_one(PgAioHandle *ioh, uint64 ref_generation);
+static int	pgaio_uring_completion_fd(void);
+static void pgaio_uring_process_completions(void);
 
 /* helper functions */
 static void pgaio_uring_sq_from_io(PgAioHandle *ioh, struct io_uring_sqe *sqe);
@@ -75,6 +77,8 @@ const IoMethodOps pgaio_uring_ops = {
 
 	.submit = pgaio_uring_submit,
 	.wait_one = pgaio_uring_wait_one,
+	.completion_fd = pgaio_uring_completion_fd,
+	.process_completions = pgaio_uring_process_completions,
 };
 
 /*
@@ -655,6 +659,35 @@ pgaio_uring_wait_one(PgAioHandle *ioh, uint64 ref_generation)
 				waited);
 }
 
+/*
+ * The io_uring instance fd polls as readable whenever unconsumed CQEs are
+ * present, which is exactly what's needed to multiplex AIO completion
+ * processing into a WaitEventSet together with latches and sockets.
+ */
+static int
+pgaio_uring_completion_fd(void)
+{
+	return pgaio_my_uring_context->io_uring_ring.ring_fd;
+}
+
+static void
+pgaio_uring_process_completions(void)
+{
+	PgAioUringContext *context = pgaio_my_uring_context;
+
+	/*
+	 * Another backend may be processing completions for us; the fd can
+	 * therefore look readable even though the queue is drained by the time
+	 * we get here.  Check cheaply before taking the lock.
+	 */
+	if (io_uring_cq_ready(&context->io_uring_ring) == 0)
+		return;
+
+	LWLockAcquire(&context->completion_lock, LW_EXCLUSIVE);
+	pgaio_uring_drain_locked(context);
+	LWLockRelease(&context->completion_lock);
+}
+
 static void
 pgaio_uring_sq_from_io(PgAioHandle *ioh, struct io_uring_sqe *sqe)
 {
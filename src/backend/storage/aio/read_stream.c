@@ -104,6 +104,7 @@ struct ReadStream
 	bool		sync_mode;		/* using io_method=sync */
 	bool		batch_mode;		/* READ_STREAM_USE_BATCHING */
 	bool		advice_enabled;
+	bool		advice_usable;	/* advice would work if not suppressed */
 	bool		temporary;
 
 	/*
@@ -668,9 +669,12 @@ read_stream_begin_impl(int flags,
 	 */
 	if (stream->sync_mode &&
 		(io_direct_flags & IO_DIRECT_DATA) == 0 &&
-		(flags & READ_STREAM_SEQUENTIAL) == 0 &&
 		max_ios > 0)
-		stream->advice_enabled = true;
+	{
+		stream->advice_usable = true;
+		if ((flags & READ_STREAM_SEQUENTIAL) == 0)
+			stream->advice_enabled = true;
+	}
 #endif
 
 	/*
@@ -1082,6 +1086,20 @@ read_stream_reset(ReadStream *stream)
 	stream->distance = 1;
 }
 
+/*
+ * Revise the READ_STREAM_SEQUENTIAL promise made when the stream was
+ * created.  Callers whose access pattern can change direction, such as heap
+ * scans fetched backwards, should withdraw the promise when they stop reading
+ * in ascending block order, so that read-ahead advice is issued where kernel
+ * read-ahead can no longer be expected to help.  Has no effect unless advice
+ * would otherwise be used (see read_stream_begin_impl()).
+ */
+void
+read_stream_set_sequential(ReadStream *stream, bool sequential)
+{
+	stream->advice_enabled = stream->advice_usable && !sequential;
+}
+
 /*
  * Release and free a read stream.
  */
@@ -220,6 +220,19 @@ static PrivateRefCountEntry *ReservedRefCountEntry = NULL;
 
 static uint32 MaxProportionalPins;
 
+/*
+ * Per-backend cache of recent buffer mapping lookups, indexed by buffer tag
+ * hash.  Entries are unvalidated hints: BufferAlloc() revalidates the tag
+ * under a pin before trusting one (the same trick ReadRecentBuffer uses), so
+ * stale entries are harmless.  A hit lets the common cache-resident path pin
+ * a buffer without touching the mapping partition lock at all, which is
+ * where buffer_mapping LWLock contention shows up on large core counts.
+ */
+#define RECENT_BUFFER_CACHE_SIZE	1024	/* must be a power of two */
+static Buffer RecentBufferCache[RECENT_BUFFER_CACHE_SIZE];
+
+#define RecentBufferCacheSlot(hash) 	(&RecentBufferCache[(hash) & (RECENT_BUFFER_CACHE_SIZE - 1)])
+
 static void ReservePrivateRefCountEntry(void);
 static PrivateRefCountEntry *NewPrivateRefCountEntry(Buffer buffer);
 static PrivateRefCountEntry *GetPrivateRefCountEntry(Buffer buffer, bool do_move);
@@ -520,6 +533,8 @@ static void UnpinBufferNoOwner(BufferDesc *buf);
 static void BufferSync(int flags);
 static int	SyncOneBuffer(int buf_id, bool skip_recently_used,
 						  WritebackContext *wb_context);
+static int	SyncBufferRun(const CkptSortItem *items, int nitems, int *written,
+						  char *copybuf, WritebackContext *wb_context);
 static void WaitIO(BufferDesc *buf);
 static void AbortBufferIO(Buffer buffer);
 static void shared_buffer_write_error_callback(void *arg);
@@ -580,6 +595,24 @@ PrefetchSharedBuffer(SMgrRelation smgr_reln,
 	newHash = BufTableHashCode(&newTag);
 	newPartitionLock = BufMappingPartitionLock(newHash);
 
+	/*
+	 * Check the backend-local recent buffer cache before touching the shared
+	 * hash table.  A match means the block was resident in that buffer a
+	 * moment ago, which is all a prefetch hint needs to know: recent_buffer
+	 * is unpinned and must be rechecked by the caller anyway (see
+	 * ReadRecentBuffer()), so a stale hit just costs the caller a retry.
+	 */
+	{
+		Buffer		recent = *RecentBufferCacheSlot(newHash);
+
+		if (recent != InvalidBuffer &&
+			BufferTagsEqual(&newTag, &GetBufferDescriptor(recent - 1)->tag))
+		{
+			result.recent_buffer = recent;
+			return result;
+		}
+	}
+
 	/* see if the block is in the buffer pool already */
 	LWLockAcquire(newPartitionLock, LW_SHARED);
 	buf_id = BufTableLookup(&newTag, newHash);
@@ -608,6 +641,7 @@ PrefetchSharedBuffer(SMgrRelation smgr_reln,
 		 * rechecked!
 		 */
 		result.recent_buffer = buf_id + 1;
+		*RecentBufferCacheSlot(newHash) = result.recent_buffer;
 	}
 
 	/*
@@ -1683,6 +1717,17 @@ WaitReadBuffers(ReadBuffersOperation *operation)
 				 */
 				pgstat_count_io_op_time(io_object, io_context, IOOP_READ,
 										io_start, 0, 0);
+
+				/* also attribute the wait to the relation, if we know it */
+				if (!INSTR_TIME_IS_ZERO(io_start) && operation->rel)
+				{
+					instr_time	io_time;
+
+					INSTR_TIME_SET_CURRENT(io_time);
+					INSTR_TIME_SUBTRACT(io_time, io_start);
+					pgstat_count_buffer_read_time_rel(operation->rel,
+													  INSTR_TIME_GET_MICROSEC(io_time));
+				}
 			}
 			else
 			{
@@ -1938,6 +1983,17 @@ AsyncReadBuffers(ReadBuffersOperation *operation, int *nblocks_progress)
 		pgstat_count_io_op_time(io_object, io_context, IOOP_READ,
 								io_start, 1, io_buffers_len * BLCKSZ);
 
+		/* also attribute the time to the relation, if we know it */
+		if (!INSTR_TIME_IS_ZERO(io_start) && operation->rel)
+		{
+			instr_time	io_time;
+
+			INSTR_TIME_SET_CURRENT(io_time);
+			INSTR_TIME_SUBTRACT(io_time, io_start);
+			pgstat_count_buffer_read_time_rel(operation->rel,
+											  INSTR_TIME_GET_MICROSEC(io_time));
+		}
+
 		if (persistence == RELPERSISTENCE_TEMP)
 			pgBufferUsage.local_blks_read += io_buffers_len;
 		else
@@ -2003,6 +2059,32 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 	newHash = BufTableHashCode(&newTag);
 	newPartitionLock = BufMappingPartitionLock(newHash);
 
+	/*
+	 * Before taking the mapping partition lock, check whether we looked this
+	 * block up recently.  The cached buffer id is only a hint, so pin first
+	 * and recheck the tag under the pin; PinBuffer's skip_if_not_valid mode
+	 * makes an invalid buffer fall through to the locked path below.
+	 */
+	{
+		Buffer		recent = *RecentBufferCacheSlot(newHash);
+
+		if (recent != InvalidBuffer)
+		{
+			BufferDesc *buf = GetBufferDescriptor(recent - 1);
+
+			if (BufferTagsEqual(&newTag, &buf->tag) &&
+				PinBuffer(buf, strategy, true))
+			{
+				if (BufferTagsEqual(&newTag, &buf->tag))
+				{
+					*foundPtr = true;
+					return buf;
+				}
+				UnpinBuffer(buf);
+			}
+		}
+	}
+
 	/* see if the block is in the buffer pool already */
 	LWLockAcquire(newPartitionLock, LW_SHARED);
 	existing_buf_id = BufTableLookup(&newTag, newHash);
@@ -2023,6 +2105,8 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 		/* Can release the mapping lock as soon as we've pinned it */
 		LWLockRelease(newPartitionLock);
 
+		*RecentBufferCacheSlot(newHash) = BufferDescriptorGetBuffer(buf);
+
 		*foundPtr = true;
 
 		if (!valid)
@@ -2126,6 +2210,8 @@ BufferAlloc(SMgrRelation smgr, char relpersistence, ForkNumber forkNum,
 
 	LWLockRelease(newPartitionLock);
 
+	*RecentBufferCacheSlot(newHash) = BufferDescriptorGetBuffer(victim_buf_hdr);
+
 	/*
 	 * Buffer contents are currently invalid.
 	 */
@@ -3354,6 +3440,7 @@ BufferSync(int flags)
 	int			i;
 	uint32		mask = BM_DIRTY;
 	WritebackContext wb_context;
+	char	   *copybuf;
 
 	/*
 	 * Unless this is a shutdown checkpoint or we have been explicitly told,
@@ -3420,6 +3507,14 @@ BufferSync(int flags)
 
 	WritebackContextInit(&wb_context, &checkpoint_flush_after);
 
+	/*
+	 * Scratch space for SyncBufferRun(): when data checksums are enabled,
+	 * pages must be copied out of shared buffers before checksumming, since
+	 * other backends may update hint bits under our share locks.
+	 */
+	copybuf = palloc_aligned((Size) io_combine_limit * BLCKSZ,
+							 PG_IO_ALIGN_SIZE, 0);
+
 	TRACE_POSTGRESQL_BUFFER_SYNC_START(NBuffers, num_to_scan);
 
 	/*
@@ -3531,43 +3626,70 @@ BufferSync(int flags)
 		BufferDesc *bufHdr = NULL;
 		CkptTsStatus *ts_stat = (CkptTsStatus *)
 			DatumGetPointer(binaryheap_first(ts_heap));
+		int			consumed = 1;
 
 		buf_id = CkptBufferIds[ts_stat->index].buf_id;
 		Assert(buf_id != -1);
 
 		bufHdr = GetBufferDescriptor(buf_id);
 
-		num_processed++;
-
 		/*
 		 * We don't need to acquire the lock here, because we're only looking
 		 * at a single bit. It's possible that someone else writes the buffer
 		 * and clears the flag right after we check, but that doesn't matter
-		 * since SyncOneBuffer will then do nothing.  However, there is a
+		 * since SyncBufferRun will then do nothing.  However, there is a
 		 * further race condition: it's conceivable that between the time we
-		 * examine the bit here and the time SyncOneBuffer acquires the lock,
+		 * examine the bit here and the time SyncBufferRun acquires the lock,
 		 * someone else not only wrote the buffer but replaced it with another
-		 * page and dirtied it.  In that improbable case, SyncOneBuffer will
+		 * page and dirtied it.  In that improbable case, SyncBufferRun will
 		 * write the buffer though we didn't need to.  It doesn't seem worth
 		 * guarding against this, though.
 		 */
 		if (pg_atomic_read_u32(&bufHdr->state) & BM_CHECKPOINT_NEEDED)
 		{
-			if (SyncOneBuffer(buf_id, false, &wb_context) & BUF_WRITTEN)
+			CkptSortItem *item = &CkptBufferIds[ts_stat->index];
+			int			run_len = 1;
+			int			written = 0;
+
+			/*
+			 * Look ahead in this tablespace's slice of the sorted array for
+			 * physically adjacent blocks, so that they can be written out
+			 * with a single vectored write.  The sort order guarantees that
+			 * any such blocks immediately follow this one.
+			 */
+			while (run_len < io_combine_limit &&
+				   ts_stat->num_scanned + run_len < ts_stat->num_to_scan)
 			{
-				TRACE_POSTGRESQL_BUFFER_SYNC_WRITTEN(buf_id);
-				PendingCheckpointerStats.buffers_written++;
-				num_written++;
+				CkptSortItem *next = item + run_len;
+
+				if (next->relNumber != item->relNumber ||
+					next->forkNum != item->forkNum ||
+					next->blockNum != item->blockNum + run_len)
+					break;
+				if (!(pg_atomic_read_u32(&GetBufferDescriptor(next->buf_id)->state) &
+					  BM_CHECKPOINT_NEEDED))
+					break;
+				run_len++;
 			}
+
+			consumed = SyncBufferRun(item, run_len, &written, copybuf,
+									 &wb_context);
+
+			for (int j = 0; j < written; j++)
+				TRACE_POSTGRESQL_BUFFER_SYNC_WRITTEN(item[j].buf_id);
+			PendingCheckpointerStats.buffers_written += written;
+			num_written += written;
 		}
 
+		num_processed += consumed;
+
 		/*
 		 * Measure progress independent of actually having to flush the buffer
 		 * - otherwise writing become unbalanced.
 		 */
-		ts_stat->progress += ts_stat->progress_slice;
-		ts_stat->num_scanned++;
-		ts_stat->index++;
+		ts_stat->progress += ts_stat->progress_slice * consumed;
+		ts_stat->num_scanned += consumed;
+		ts_stat->index += consumed;
 
 		/* Have all the buffers from the tablespace been processed? */
 		if (ts_stat->num_scanned == ts_stat->num_to_scan)
@@ -3594,6 +3716,7 @@ BufferSync(int flags)
 	 */
 	IssuePendingWritebacks(&wb_context, IOCONTEXT_NORMAL);
 
+	pfree(copybuf);
 	pfree(per_ts_stat);
 	per_ts_stat = NULL;
 	binaryheap_free(ts_heap);
@@ -3979,6 +4102,230 @@ SyncOneBuffer(int buf_id, bool skip_recently_used, WritebackContext *wb_context)
 	return result | BUF_WRITTEN;
 }
 
+/*
+ * SyncBufferRun -- write out a run of physically adjacent dirty buffers.
+ *
+ * items points at nitems entries of the checkpoint sort array that were seen
+ * to hold consecutive blocks of one relation fork.  Write as long a prefix
+ * of the run as possible with a single vectored smgrwritev() call, so that
+ * sorted checkpoint writes reach the disk as large sequential I/Os instead
+ * of block-sized ones.
+ *
+ * The first buffer is handled just as SyncOneBuffer() would: we're prepared
+ * to wait for its content lock and I/O-in-progress flag.  For later buffers
+ * we only use conditional acquisition and terminate the run on failure,
+ * since waiting while holding locks on earlier run members could deadlock
+ * against a backend locking the same buffers in the opposite order.
+ *
+ * copybuf is scratch space of io_combine_limit blocks, used to copy pages
+ * out of shared memory when checksums have to be computed.
+ *
+ * Returns the number of array entries consumed; *written is set to the
+ * number of buffers actually written.  An entry is consumed without being
+ * written only when its buffer no longer needs writing; this can only
+ * happen for the first entry, entries the run lost are left for the caller
+ * to retry.
+ */
+static int
+SyncBufferRun(const CkptSortItem *items, int nitems, int *written,
+			  char *copybuf, WritebackContext *wb_context)
+{
+	BufferDesc *bufs[MAX_IO_COMBINE_LIMIT];
+	const void *pages[MAX_IO_COMBINE_LIMIT];
+	RelFileLocator rlocator = {0};
+	ForkNumber	forknum = InvalidForkNumber;
+	BlockNumber first_blockno = InvalidBlockNumber;
+	int			nrun = 0;
+	XLogRecPtr	max_recptr = InvalidXLogRecPtr;
+	bool		need_wal_flush = false;
+	SMgrRelation reln;
+	ErrorContextCallback errcallback;
+	instr_time	io_start;
+
+	Assert(nitems >= 1 && nitems <= io_combine_limit);
+
+	*written = 0;
+
+	/*
+	 * Collect the buffers of the run, pinning, share-locking and setting
+	 * BM_IO_IN_PROGRESS on each.
+	 */
+	for (int i = 0; i < nitems; i++)
+	{
+		BufferDesc *bufHdr = GetBufferDescriptor(items[i].buf_id);
+		uint32		buf_state;
+
+		/* Make sure we can handle the pin */
+		ReservePrivateRefCountEntry();
+		ResourceOwnerEnlarge(CurrentResourceOwner);
+
+		/*
+		 * Check whether the buffer still needs writing.  The header lock is
+		 * enough for this; see SyncOneBuffer().
+		 */
+		buf_state = LockBufHdr(bufHdr);
+		if (!(buf_state & BM_VALID) || !(buf_state & BM_DIRTY))
+		{
+			/* It's clean, so nothing to do */
+			UnlockBufHdr(bufHdr);
+			if (i == 0)
+				return 1;
+			break;
+		}
+
+		if (i == 0)
+		{
+			/*
+			 * The first buffer determines what we write.  It could have been
+			 * replaced with another page since the caller examined it;
+			 * that's harmless, we write whatever dirty block it holds now,
+			 * exactly as SyncOneBuffer() would, but then no further buffer
+			 * can match it and the run will end immediately.
+			 */
+			rlocator = BufTagGetRelFileLocator(&bufHdr->tag);
+			forknum = BufTagGetForkNum(&bufHdr->tag);
+			first_blockno = bufHdr->tag.blockNum;
+		}
+		else if (!RelFileLocatorEquals(BufTagGetRelFileLocator(&bufHdr->tag),
+									   rlocator) ||
+				 BufTagGetForkNum(&bufHdr->tag) != forknum ||
+				 bufHdr->tag.blockNum != first_blockno + i)
+		{
+			/*
+			 * Later buffers must still hold the expected block.  Note that
+			 * comparing the full tag also catches relations of different
+			 * databases that share a relfilenumber, which the sort array
+			 * cannot distinguish.
+			 */
+			UnlockBufHdr(bufHdr);
+			break;
+		}
+
+		PinBuffer_Locked(bufHdr);
+
+		if (i == 0)
+			LWLockAcquire(BufferDescriptorGetContentLock(bufHdr), LW_SHARED);
+		else if (!LWLockConditionalAcquire(BufferDescriptorGetContentLock(bufHdr),
+										   LW_SHARED))
+		{
+			UnpinBuffer(bufHdr);
+			break;
+		}
+
+		if (!StartBufferIO(bufHdr, false, i > 0))
+		{
+			/* Someone else flushed it, or (for i > 0) has I/O in progress */
+			LWLockRelease(BufferDescriptorGetContentLock(bufHdr));
+			UnpinBuffer(bufHdr);
+			if (i == 0)
+				return 1;
+			break;
+		}
+
+		bufs[nrun++] = bufHdr;
+	}
+
+	Assert(nrun >= 1);
+
+	/* Setup error traceback support for ereport() */
+	errcallback.callback = shared_buffer_write_error_callback;
+	errcallback.arg = bufs[0];
+	errcallback.previous = error_context_stack;
+	error_context_stack = &errcallback;
+
+	reln = smgropen(rlocator, INVALID_PROC_NUMBER);
+
+	/*
+	 * Collect each buffer's LSN and clear BM_JUST_DIRTIED, then force the
+	 * WAL out far enough to cover the whole run.  See FlushBuffer() for why
+	 * unlogged buffers must not cause a WAL flush.
+	 */
+	for (int i = 0; i < nrun; i++)
+	{
+		BufferDesc *bufHdr = bufs[i];
+		XLogRecPtr	recptr;
+		uint32		buf_state;
+
+		buf_state = LockBufHdr(bufHdr);
+		recptr = BufferGetLSN(bufHdr);
+		UnlockBufHdrExt(bufHdr, buf_state,
+						0, BM_JUST_DIRTIED,
+						0);
+
+		if (buf_state & BM_PERMANENT)
+		{
+			need_wal_flush = true;
+			if (recptr > max_recptr)
+				max_recptr = recptr;
+		}
+	}
+	if (need_wal_flush)
+		XLogFlush(max_recptr);
+
+	/*
+	 * Now it's safe to write the run.  We hold only share locks, so hint
+	 * bits may still change under us; as in PageSetChecksumCopy(), each page
+	 * that needs a checksum is copied to private storage and checksummed
+	 * there, while other pages are written directly from shared memory.
+	 */
+	for (int i = 0; i < nrun; i++)
+	{
+		Block		bufBlock = BufHdrGetBlock(bufs[i]);
+
+		TRACE_POSTGRESQL_BUFFER_FLUSH_START(forknum,
+											first_blockno + i,
+											reln->smgr_rlocator.locator.spcOid,
+											reln->smgr_rlocator.locator.dbOid,
+											reln->smgr_rlocator.locator.relNumber);
+
+		if (!PageIsNew((Page) bufBlock) && DataChecksumsEnabled())
+		{
+			char	   *copy = copybuf + (Size) i * BLCKSZ;
+
+			memcpy(copy, bufBlock, BLCKSZ);
+			PageSetChecksumInplace((Page) copy, first_blockno + i);
+			pages[i] = copy;
+		}
+		else
+			pages[i] = bufBlock;
+	}
+
+	io_start = pgstat_prepare_io_time(track_io_timing);
+
+	smgrwritev(reln, forknum, first_blockno, pages, nrun, false);
+
+	pgstat_count_io_op_time(IOOBJECT_RELATION, IOCONTEXT_NORMAL,
+							IOOP_WRITE, io_start, 1, (uint64) nrun * BLCKSZ);
+
+	pgBufferUsage.shared_blks_written += nrun;
+
+	/* Mark the buffers clean, release them, and schedule writeback */
+	for (int i = 0; i < nrun; i++)
+	{
+		BufferDesc *bufHdr = bufs[i];
+		BufferTag	tag;
+
+		TerminateBufferIO(bufHdr, true, 0, true, false);
+
+		TRACE_POSTGRESQL_BUFFER_FLUSH_DONE(forknum,
+										   first_blockno + i,
+										   reln->smgr_rlocator.locator.spcOid,
+										   reln->smgr_rlocator.locator.dbOid,
+										   reln->smgr_rlocator.locator.relNumber);
+
+		LWLockRelease(BufferDescriptorGetContentLock(bufHdr));
+		tag = bufHdr->tag;
+		UnpinBuffer(bufHdr);
+		ScheduleBufferTagForWriteback(wb_context, IOCONTEXT_NORMAL, &tag);
+	}
+
+	/* Pop the error context stack */
+	error_context_stack = errcallback.previous;
+
+	*written = nrun;
+	return nrun;
+}
+
 /*
  *		AtEOXact_Buffers - clean up at end of transaction.
  *
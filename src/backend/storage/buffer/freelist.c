@@ -56,6 +56,19 @@ typedef struct
 /* Pointers to shared state */
 static BufferStrategyControl *StrategyControl = NULL;
 
+/*
+ * Backend-local batch of clock-sweep ticks.  Claiming ticks in batches keeps
+ * the shared nextVictimBuffer cacheline from bouncing between sockets on
+ * every victim search; each backend pays one atomic fetch-add per
+ * CLOCK_SWEEP_BATCH_SIZE candidates instead of one per candidate.  Ticks
+ * left over in a batch are consumed by this backend's next victim search,
+ * so the hand a backend works from can lag the shared hand by at most the
+ * batch size, which the clock-sweep algorithm tolerates fine.
+ */
+#define CLOCK_SWEEP_BATCH_SIZE	16
+static uint32 ClockSweepBatchNext = 0;
+static uint32 ClockSweepBatchRemaining = 0;
+
 /*
  * Private (non-shared) state for managing a ring of shared buffers to re-use.
  * This is currently the only kind of BufferAccessStrategy object, but someday
@@ -101,58 +114,70 @@ ClockSweepTick(void)
 {
 	uint32		victim;
 
+	/* serve from the local batch when possible */
+	if (ClockSweepBatchRemaining > 0)
+	{
+		victim = ClockSweepBatchNext++;
+		ClockSweepBatchRemaining--;
+		return victim % NBuffers;
+	}
+
 	/*
-	 * Atomically move hand ahead one buffer - if there's several processes
-	 * doing this, this can lead to buffers being returned slightly out of
-	 * apparent order.
+	 * Atomically move the hand ahead a whole batch - if there's several
+	 * processes doing this, this can lead to buffers being returned slightly
+	 * out of apparent order.
 	 */
 	victim =
-		pg_atomic_fetch_add_u32(&StrategyControl->nextVictimBuffer, 1);
+		pg_atomic_fetch_add_u32(&StrategyControl->nextVictimBuffer,
+								CLOCK_SWEEP_BATCH_SIZE);
+	ClockSweepBatchNext = victim + 1;
+	ClockSweepBatchRemaining = CLOCK_SWEEP_BATCH_SIZE - 1;
 
-	if (victim >= NBuffers)
+	/*
+	 * If our batch crossed a multiple of NBuffers, we're responsible for
+	 * forcing completePasses to be incremented while holding the spinlock,
+	 * and for wrapping nextVictimBuffer back down.  We need the spinlock so
+	 * StrategySyncStart() can return a consistent value consisting of
+	 * nextVictimBuffer and completePasses.
+	 *
+	 * The crossing test must be made on the pre-add position: a batch that
+	 * starts just below a multiple of NBuffers crosses it even though the
+	 * value the fetch-add returned has not wrapped yet.  (Since
+	 * CLOCK_SWEEP_BATCH_SIZE never exceeds the minimum NBuffers, a batch
+	 * can cross at most one such boundary.)
+	 */
+	if (victim % NBuffers + CLOCK_SWEEP_BATCH_SIZE >= NBuffers)
 	{
-		uint32		originalVictim = victim;
+		uint32		expected;
+		uint32		wrapped;
+		bool		success = false;
 
-		/* always wrap what we look up in BufferDescriptors */
-		victim = victim % NBuffers;
+		expected = victim + CLOCK_SWEEP_BATCH_SIZE;
 
-		/*
-		 * If we're the one that just caused a wraparound, force
-		 * completePasses to be incremented while holding the spinlock. We
-		 * need the spinlock so StrategySyncStart() can return a consistent
-		 * value consisting of nextVictimBuffer and completePasses.
-		 */
-		if (victim == 0)
+		while (!success)
 		{
-			uint32		expected;
-			uint32		wrapped;
-			bool		success = false;
-
-			expected = originalVictim + 1;
-
-			while (!success)
-			{
-				/*
-				 * Acquire the spinlock while increasing completePasses. That
-				 * allows other readers to read nextVictimBuffer and
-				 * completePasses in a consistent manner which is required for
-				 * StrategySyncStart().  In theory delaying the increment
-				 * could lead to an overflow of nextVictimBuffers, but that's
-				 * highly unlikely and wouldn't be particularly harmful.
-				 */
-				SpinLockAcquire(&StrategyControl->buffer_strategy_lock);
+			/*
+			 * Acquire the spinlock while increasing completePasses. That
+			 * allows other readers to read nextVictimBuffer and
+			 * completePasses in a consistent manner which is required for
+			 * StrategySyncStart().  In theory delaying the increment could
+			 * lead to an overflow of nextVictimBuffers, but that's highly
+			 * unlikely and wouldn't be particularly harmful.
+			 */
+			SpinLockAcquire(&StrategyControl->buffer_strategy_lock);
 
-				wrapped = expected % NBuffers;
+			wrapped = expected % NBuffers;
 
-				success = pg_atomic_compare_exchange_u32(&StrategyControl->nextVictimBuffer,
-														 &expected, wrapped);
-				if (success)
-					StrategyControl->completePasses++;
-				SpinLockRelease(&StrategyControl->buffer_strategy_lock);
-			}
+			success = pg_atomic_compare_exchange_u32(&StrategyControl->nextVictimBuffer,
+													 &expected, wrapped);
+			if (success)
+				StrategyControl->completePasses++;
+			SpinLockRelease(&StrategyControl->buffer_strategy_lock);
 		}
 	}
-	return victim;
+
+	/* always wrap what we look up in BufferDescriptors */
+	return victim % NBuffers;
 }
 
 /*
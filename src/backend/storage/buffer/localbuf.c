@@ -4,6 +4,18 @@
  *	  local buffer manager. Fast buffer manager for temporary tables,
  *	  which never need to be WAL-logged or checkpointed, etc.
  *
+ * The pool is sized from temp_buffers at the first access to a temp table
+ * and keeps that size for the life of the backend.  Resizing afterwards is
+ * less attractive than it looks: Buffer values encode indexes into the
+ * arrays below, so the pool could only grow, and SET is transactional while
+ * a grown pool cannot shrink on abort, leaving the GUC and the pool
+ * disagreeing.  Note that the fixed size costs little up front — buffer
+ * memory is allocated lazily, one buffer at a time, as buffers are first
+ * used (see GetLocalBufferStorage) — so sessions that might scan large temp
+ * tables should simply set temp_buffers generously before touching any.
+ * Reads of temp relations go through read_stream.c like shared-buffer reads
+ * do; only the memory budget, not the I/O path, is fixed at first use.
+ *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994-5, Regents of the University of California
  *
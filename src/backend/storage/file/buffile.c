@@ -96,6 +96,14 @@ struct BufFile
 	int			pos;			/* next read/write position in buffer */
 	int			nbytes;			/* total # of valid bytes in buffer */
 
+	/*
+	 * Position just past the last bufferload read, used to detect sequential
+	 * reads so that BufFileLoadBuffer can issue a read-ahead hint for the
+	 * next bufferload.  (Only used when prefetching is available.)
+	 */
+	int			seqFile;		/* file index of last read */
+	off_t		nextSeqOffset;	/* offset just past last read */
+
 	/*
 	 * XXX Should ideally use PGIOAlignedBlock, but might need a way to avoid
 	 * wasting per-file alignment padding when some users create many files.
@@ -127,6 +135,8 @@ makeBufFileCommon(int nfiles)
 	file->curOffset = 0;
 	file->pos = 0;
 	file->nbytes = 0;
+	file->seqFile = 0;
+	file->nextSeqOffset = 0;
 
 	return file;
 }
@@ -477,6 +487,31 @@ BufFileLoadBuffer(BufFile *file)
 		INSTR_TIME_ACCUM_DIFF(pgBufferUsage.temp_blk_read_time, io_time, io_start);
 	}
 
+#ifdef USE_PREFETCH
+
+	/*
+	 * If this read continued a sequential scan, hint the kernel to read the
+	 * next bufferload ahead of us.  The kernel's own readahead heuristics
+	 * would often cover this, but fd.c recycles file descriptors when many
+	 * temp files are open (as in a multi-batch hash join), and each reopen
+	 * starts the kernel's sequential detection from scratch.  Errors are
+	 * ignored; this is only a hint.
+	 */
+	if (file->nbytes == sizeof(file->buffer.data) &&
+		file->curFile == file->seqFile &&
+		file->curOffset == file->nextSeqOffset)
+	{
+		off_t		nextOffset = file->curOffset + (off_t) file->nbytes;
+
+		if (nextOffset + (off_t) sizeof(file->buffer.data) <= MAX_PHYSICAL_FILESIZE)
+			(void) FilePrefetch(thisfile, nextOffset,
+								sizeof(file->buffer.data),
+								WAIT_EVENT_BUFFILE_READ);
+	}
+	file->seqFile = file->curFile;
+	file->nextSeqOffset = file->curOffset + file->nbytes;
+#endif
+
 	/* we choose not to advance curOffset here */
 
 	if (file->nbytes > 0)
@@ -856,6 +891,36 @@ BufFileSeekBlock(BufFile *file, int64 blknum)
 					   SEEK_SET);
 }
 
+/*
+ * BufFilePrefetch
+ *
+ * Initiate an asynchronous read hint for the given byte range of the file.
+ * This is purely advisory: errors are ignored, and on platforms without
+ * prefetch support it does nothing.  The range may span component files,
+ * and any part of it lying beyond the data written so far is silently
+ * dropped.
+ */
+void
+BufFilePrefetch(BufFile *file, int64 offset, int64 amount,
+				uint32 wait_event_info)
+{
+#ifdef USE_PREFETCH
+	while (amount > 0)
+	{
+		int			fileno = (int) (offset / MAX_PHYSICAL_FILESIZE);
+		pgoff_t		seekpos = (pgoff_t) (offset % MAX_PHYSICAL_FILESIZE);
+		pgoff_t		thislen = Min(amount, MAX_PHYSICAL_FILESIZE - seekpos);
+
+		if (fileno >= file->numFiles)
+			break;
+		(void) FilePrefetch(file->files[fileno], seekpos, thislen,
+							wait_event_info);
+		offset += thislen;
+		amount -= thislen;
+	}
+#endif
+}
+
 /*
  * Returns the amount of data in the given BufFile, in bytes.
  *
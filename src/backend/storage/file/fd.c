@@ -4001,7 +4001,7 @@ data_sync_elevel(int elevel)
 }
 
 bool
-check_debug_io_direct(char **newval, void **extra, GucSource source)
+check_io_direct(char **newval, void **extra, GucSource source)
 {
 	bool		result = true;
 	int			flags;
@@ -4010,7 +4010,7 @@ check_debug_io_direct(char **newval, void **extra, GucSource source)
 	if (strcmp(*newval, "") != 0)
 	{
 		GUC_check_errdetail("\"%s\" is not supported on this platform.",
-							"debug_io_direct");
+							"io_direct");
 		result = false;
 	}
 	flags = 0;
@@ -4025,7 +4025,7 @@ check_debug_io_direct(char **newval, void **extra, GucSource source)
 	if (!SplitGUCList(rawstring, ',', &elemlist))
 	{
 		GUC_check_errdetail("Invalid list syntax in parameter \"%s\".",
-							"debug_io_direct");
+							"io_direct");
 		pfree(rawstring);
 		list_free(elemlist);
 		return false;
@@ -4058,7 +4058,7 @@ check_debug_io_direct(char **newval, void **extra, GucSource source)
 	if (result && (flags & (IO_DIRECT_WAL | IO_DIRECT_WAL_INIT)))
 	{
 		GUC_check_errdetail("\"%s\" is not supported for WAL because %s is too small.",
-							"debug_io_direct", "XLOG_BLCKSZ");
+							"io_direct", "XLOG_BLCKSZ");
 		result = false;
 	}
 #endif
@@ -4066,7 +4066,7 @@ check_debug_io_direct(char **newval, void **extra, GucSource source)
 	if (result && (flags & IO_DIRECT_DATA))
 	{
 		GUC_check_errdetail("\"%s\" is not supported for data because %s is too small.",
-							"debug_io_direct", "BLCKSZ");
+							"io_direct", "BLCKSZ");
 		result = false;
 	}
 #endif
@@ -4078,7 +4078,7 @@ check_debug_io_direct(char **newval, void **extra, GucSource source)
 	if (!result)
 		return result;
 
-	/* Save the flags in *extra, for use by assign_debug_io_direct */
+	/* Save the flags in *extra, for use by assign_io_direct */
 	*extra = guc_malloc(LOG, sizeof(int));
 	if (!*extra)
 		return false;
@@ -4088,7 +4088,7 @@ check_debug_io_direct(char **newval, void **extra, GucSource source)
 }
 
 void
-assign_debug_io_direct(const char *newval, void *extra)
+assign_io_direct(const char *newval, void *extra)
 {
 	int		   *flags = (int *) extra;
 
@@ -465,6 +465,13 @@ dsm_set_control_handle(dsm_handle h)
 
 /*
  * Reserve some space in the main shared memory segment for DSM segments.
+ *
+ * Segments carved out of this space (see dsm_create) are already mapped in
+ * every backend, so creating and destroying them involves no system calls
+ * and no mmap/munmap churn, just free page list manipulation.  This is the
+ * supported way to pool DSM segments for workloads that run many short
+ * parallel queries: size min_dynamic_shared_memory to cover the steady-state
+ * demand, and only overflow segments pay the operating-system setup cost.
  */
 size_t
 dsm_estimate_size(void)
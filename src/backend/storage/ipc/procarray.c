@@ -441,7 +441,7 @@ ProcArrayShmemInit(void)
 		procArray->lastOverflowedXid = InvalidTransactionId;
 		procArray->replication_slot_xmin = InvalidTransactionId;
 		procArray->replication_slot_catalog_xmin = InvalidTransactionId;
-		TransamVariables->xactCompletionCount = 1;
+		pg_atomic_init_u64(&TransamVariables->xactCompletionCount, 1);
 	}
 
 	allProcs = ProcGlobal->allProcs;
@@ -591,7 +591,7 @@ ProcArrayRemove(PGPROC *proc, TransactionId latestXid)
 		MaintainLatestCompletedXid(latestXid);
 
 		/* Same with xactCompletionCount  */
-		TransamVariables->xactCompletionCount++;
+		pg_atomic_fetch_add_u64(&TransamVariables->xactCompletionCount, 1);
 
 		ProcGlobal->xids[myoff] = InvalidTransactionId;
 		ProcGlobal->subxidStates[myoff].overflowed = false;
@@ -773,7 +773,7 @@ ProcArrayEndTransactionInternal(PGPROC *proc, TransactionId latestXid)
 	MaintainLatestCompletedXid(latestXid);
 
 	/* Same with xactCompletionCount  */
-	TransamVariables->xactCompletionCount++;
+	pg_atomic_fetch_add_u64(&TransamVariables->xactCompletionCount, 1);
 }
 
 /*
@@ -943,7 +943,7 @@ ProcArrayClearTransaction(PGPROC *proc)
 	 * otherwise could end up reusing the snapshot later. Which would be bad,
 	 * because it might not count the prepared transaction as running.
 	 */
-	TransamVariables->xactCompletionCount++;
+	pg_atomic_fetch_add_u64(&TransamVariables->xactCompletionCount, 1);
 
 	/* Clear the subtransaction-XID cache too */
 	Assert(ProcGlobal->subxidStates[pgxactoff].count == proc->subxidStatus.count &&
@@ -2036,20 +2036,21 @@ GetMaxSnapshotSubxidCount(void)
  * the fields that need to change and returns true. Otherwise it returns
  * false.
  *
- * This very likely can be evolved to not need ProcArrayLock held (at very
- * least in the case we already hold a snapshot), but that's for another day.
+ * This works both with and without ProcArrayLock held, as indicated by
+ * have_lock.  In the unlocked case we may have to publish our xmin with a
+ * seqlock-style recheck, see below.
  */
 static bool
-GetSnapshotDataReuse(Snapshot snapshot)
+GetSnapshotDataReuse(Snapshot snapshot, bool have_lock)
 {
 	uint64		curXactCompletionCount;
 
-	Assert(LWLockHeldByMe(ProcArrayLock));
+	Assert(have_lock == LWLockHeldByMe(ProcArrayLock));
 
 	if (unlikely(snapshot->snapXactCompletionCount == 0))
 		return false;
 
-	curXactCompletionCount = TransamVariables->xactCompletionCount;
+	curXactCompletionCount = pg_atomic_read_u64(&TransamVariables->xactCompletionCount);
 	if (curXactCompletionCount != snapshot->snapXactCompletionCount)
 		return false;
 
@@ -2074,8 +2075,43 @@ GetSnapshotDataReuse(Snapshot snapshot)
 	 * xmin.
 	 */
 	if (!TransactionIdIsValid(MyProc->xmin))
+	{
+		TransactionId oldTransactionXmin = TransactionXmin;
+
 		MyProc->xmin = TransactionXmin = snapshot->xmin;
 
+		if (!have_lock)
+		{
+			/*
+			 * Without the lock, rows visible under the snapshot are only
+			 * protected from removal once our xmin store is visible to
+			 * horizon computations.  Make the store visible, then verify
+			 * that no transaction completed concurrently; if one did, some
+			 * horizon computation may have missed our xmin, so retract it
+			 * and fall back to the locked path.  (The barrier pairs with the
+			 * lock operations performed when advancing the counter.)
+			 */
+			pg_memory_barrier();
+			if (pg_atomic_read_u64(&TransamVariables->xactCompletionCount) !=
+				curXactCompletionCount)
+			{
+				MyProc->xmin = InvalidTransactionId;
+				TransactionXmin = oldTransactionXmin;
+				return false;
+			}
+		}
+	}
+	else if (!have_lock)
+	{
+		/*
+		 * Our existing xmin already protects the snapshot's rows, but make
+		 * sure no transaction completed between the snapshot being built
+		 * and the counter read above being reordered ahead of the caller's
+		 * decision to take a new snapshot.
+		 */
+		pg_read_barrier();
+	}
+
 	RecentXmin = snapshot->xmin;
 	Assert(TransactionIdPrecedesOrEquals(TransactionXmin, RecentXmin));
 
@@ -2172,13 +2208,21 @@ GetSnapshotData(Snapshot snapshot)
 					 errmsg("out of memory")));
 	}
 
+	/*
+	 * First see whether the previous snapshot can be reused without taking
+	 * ProcArrayLock at all.  On read-mostly workloads most snapshots can be
+	 * served this way, taking the lock off the read path entirely.
+	 */
+	if (GetSnapshotDataReuse(snapshot, false))
+		return snapshot;
+
 	/*
 	 * It is sufficient to get shared lock on ProcArrayLock, even if we are
 	 * going to set MyProc->xmin.
 	 */
 	LWLockAcquire(ProcArrayLock, LW_SHARED);
 
-	if (GetSnapshotDataReuse(snapshot))
+	if (GetSnapshotDataReuse(snapshot, true))
 	{
 		LWLockRelease(ProcArrayLock);
 		return snapshot;
@@ -2190,7 +2234,7 @@ GetSnapshotData(Snapshot snapshot)
 	Assert(myxid == MyProc->xid);
 
 	oldestxid = TransamVariables->oldestXid;
-	curXactCompletionCount = TransamVariables->xactCompletionCount;
+	curXactCompletionCount = pg_atomic_read_u64(&TransamVariables->xactCompletionCount);
 
 	/* xmax is always latestCompletedXid + 1 */
 	xmax = XidFromFullTransactionId(latest_completed);
@@ -2205,6 +2249,7 @@ GetSnapshotData(Snapshot snapshot)
 		xmin = myxid;
 
 	snapshot->takenDuringRecovery = RecoveryInProgress();
+	snapshot->last_lookup_xid = InvalidTransactionId;
 
 	if (!snapshot->takenDuringRecovery)
 	{
@@ -4027,7 +4072,7 @@ XidCacheRemoveRunningXids(TransactionId xid,
 	MaintainLatestCompletedXid(latestXid);
 
 	/* ... and xactCompletionCount */
-	TransamVariables->xactCompletionCount++;
+	pg_atomic_fetch_add_u64(&TransamVariables->xactCompletionCount, 1);
 
 	LWLockRelease(ProcArrayLock);
 }
@@ -4447,7 +4492,7 @@ ExpireTreeKnownAssignedTransactionIds(TransactionId xid, int nsubxids,
 	MaintainLatestCompletedXidRecovery(max_xid);
 
 	/* ... and xactCompletionCount */
-	TransamVariables->xactCompletionCount++;
+	pg_atomic_fetch_add_u64(&TransamVariables->xactCompletionCount, 1);
 
 	LWLockRelease(ProcArrayLock);
 }
@@ -4474,7 +4519,7 @@ ExpireAllKnownAssignedTransactionIds(void)
 	 * Any transactions that were in-progress were effectively aborted, so
 	 * advance xactCompletionCount.
 	 */
-	TransamVariables->xactCompletionCount++;
+	pg_atomic_fetch_add_u64(&TransamVariables->xactCompletionCount, 1);
 
 	/*
 	 * Reset lastOverflowedXid.  Currently, lastOverflowedXid has no use after
@@ -4503,7 +4548,7 @@ ExpireOldKnownAssignedTransactionIds(TransactionId xid)
 	MaintainLatestCompletedXidRecovery(latestXid);
 
 	/* ... and xactCompletionCount */
-	TransamVariables->xactCompletionCount++;
+	pg_atomic_fetch_add_u64(&TransamVariables->xactCompletionCount, 1);
 
 	/*
 	 * Reset lastOverflowedXid if we know all transactions that have been
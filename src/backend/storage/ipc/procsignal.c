@@ -278,6 +278,15 @@ CleanupProcSignalState(int status, Datum arg)
  * On success (a signal was sent), zero is returned.
  * On error, -1 is returned, and errno is set (typically to ESRCH or EPERM).
  *
+ * Note that the shared-memory flag word set here already is the "doorbell":
+ * the reason is recorded in pss_signalFlags with no syscall, and a busy
+ * backend picks it up at its next CHECK_FOR_INTERRUPTS.  The kill() is not
+ * how the information travels — it exists to wake a target that is asleep
+ * in a syscall (latch wait, blocking read) and would otherwise not look at
+ * the flags until it woke for some other reason.  Dropping it in favor of
+ * pure polling would turn signal latency into "whenever the target next
+ * executes an interrupt check", which for an idle backend is unbounded.
+ *
  * Not to be confused with ProcSendSignal
  */
 int
@@ -439,6 +439,18 @@ static void GetSingleProcBlockerStatusData(PGPROC *blocked_proc,
  * EXEC_BACKEND case, each backend re-executes this code to obtain pointers to
  * the already existing shared hash tables.  In either case, each backend must
  * also call InitLockManagerAccess() to create the locallock hash table.
+ *
+ * Dynahash's chained buckets are not the cache-friendliest layout, and
+ * replacing these tables with a simplehash-style open-addressing design has
+ * been floated.  What that overlooks is that dynahash never moves an entry
+ * once created: PROCLOCKs store bare pointers into the LOCK table, dlist
+ * links are threaded through both entry types, and deadlock detection and
+ * error recovery chase those pointers with no table in hand.  Open
+ * addressing relocates entries on insert and delete, so inline entries
+ * would invalidate every such cross-reference.  Freelist pressure in
+ * get_hash_entry is already split across freelists by HASH_PARTITION, and
+ * the fast-path slots in PGPROC keep weak relation locks out of these
+ * tables entirely, which is where the big win was.
  */
 void
 LockManagerShmemInit(void)
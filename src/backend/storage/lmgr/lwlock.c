@@ -849,6 +849,80 @@ LWLockAttemptLock(LWLock *lock, LWLockMode mode)
 	pg_unreachable();
 }
 
+/*
+ * Bounds for the per-tranche adaptive spin limits, in iterations of the
+ * spin loop in LWLockAttemptSpin().  The floor is kept above zero so that a
+ * tranche whose limit has decayed can still discover that spinning has
+ * become profitable again.
+ */
+#define LW_SPIN_LIMIT_MIN		8
+#define LW_SPIN_LIMIT_DEFAULT	128
+#define LW_SPIN_LIMIT_MAX		1024
+
+/*
+ * Per-tranche spin limits, adapted from acquisition outcomes.  These are
+ * backend-local: contention patterns are similar across backends, and a
+ * shared counter would itself bounce between caches.  Tranches registered by
+ * extensions share the last slot.  A zero entry means "not adapted yet" and
+ * stands for LW_SPIN_LIMIT_DEFAULT.
+ */
+static uint16 LWLockSpinLimits[LWTRANCHE_FIRST_USER_DEFINED + 1];
+
+/*
+ * Spin briefly in the hope that the lock is released before we go to the
+ * trouble of queueing ourselves and sleeping on our semaphore.  LWLock hold
+ * times are mostly far shorter than the cost of a sleep/wakeup cycle, so at
+ * moderate contention a short spin frequently succeeds; at saturation it
+ * cannot, so the spin duration adapts per tranche: multiplicative decrease
+ * whenever a spin times out, additive increase whenever one succeeds.  On a
+ * single processor (or when the holder routinely sleeps while holding the
+ * lock) the limits quickly decay to the floor, keeping the wasted work
+ * negligible.
+ *
+ * We never spin while other waiters are queued: that would let us jump the
+ * queue, and the lock will in any case be handed to them first.
+ *
+ * Returns true if the lock was acquired, in which case the caller is done;
+ * false if it must queue and sleep as usual.
+ */
+static bool
+LWLockAttemptSpin(LWLock *lock, LWLockMode mode)
+{
+	int			idx = Min(lock->tranche, lengthof(LWLockSpinLimits) - 1);
+	int			limit = LWLockSpinLimits[idx];
+
+	if (limit == 0)
+		limit = LW_SPIN_LIMIT_DEFAULT;
+
+	for (int i = 0; i < limit; i++)
+	{
+		uint32		state = pg_atomic_read_u32(&lock->state);
+
+		if (state & LW_FLAG_HAS_WAITERS)
+			break;
+
+		if (mode == LW_EXCLUSIVE ?
+			(state & LW_LOCK_MASK) == 0 :
+			(state & LW_VAL_EXCLUSIVE) == 0)
+		{
+			if (!LWLockAttemptLock(lock, mode))
+			{
+				LWLockSpinLimits[idx] =
+					Min(limit + LW_SPIN_LIMIT_MIN, LW_SPIN_LIMIT_MAX);
+				return true;
+			}
+
+			/* lost the race; the cmpxchg already served as a delay */
+			continue;
+		}
+
+		SPIN_DELAY();
+	}
+
+	LWLockSpinLimits[idx] = Max(limit / 2, LW_SPIN_LIMIT_MIN);
+	return false;
+}
+
 /*
  * Lock the LWLock's wait list against concurrent activity.
  *
@@ -1244,6 +1318,17 @@ LWLockAcquire(LWLock *lock, LWLockMode mode)
 			break;				/* got the lock */
 		}
 
+		/*
+		 * The lock is taken.  Before paying for a sleep/wakeup cycle, spin
+		 * for a bit in case the holder releases it quickly; see
+		 * LWLockAttemptSpin().
+		 */
+		if (LWLockAttemptSpin(lock, mode))
+		{
+			LOG_LWDEBUG("LWLockAcquire", lock, "acquired by spinning");
+			break;				/* got the lock */
+		}
+
 		/*
 		 * Ok, at this point we couldn't grab the lock on the first try. We
 		 * cannot simply queue ourselves to the end of the list and wait to be
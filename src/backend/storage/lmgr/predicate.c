@@ -133,6 +133,19 @@
  *
  *	SerializableXactHashLock
  *		- Protects both PredXact and SerializableXidHash.
+ *		- This is the scalability ceiling for short serializable
+ *			transactions at high core counts: every transaction start and
+ *			finish takes it exclusively, independent of conflict rate.
+ *			Sharding it per backend is not a local change, because the
+ *			structures it protects are global by design: transaction start
+ *			must position the new sxact against every concurrent sxact
+ *			(SxactGlobalXmin and the active list), finish must be visible
+ *			to every concurrent backend's conflict detection, and the
+ *			RWConflict pool links pairs of sxacts owned by different
+ *			backends.  Any proposal to split this lock has to specify how
+ *			the global xmin and the cross-backend conflict lists are kept
+ *			coherent (e.g. epoch-based schemes move that cost to
+ *			reclamation time but still need a global view there).
  *
  *	SerialControlLock
  *		- Protects SerialControlData members
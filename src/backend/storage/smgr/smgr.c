@@ -273,6 +273,7 @@ smgropen(RelFileLocator rlocator, ProcNumber backend)
 		reln->smgr_targblock = InvalidBlockNumber;
 		for (int i = 0; i <= MAX_FORKNUM; ++i)
 			reln->smgr_cached_nblocks[i] = InvalidBlockNumber;
+		reln->smgr_extend_hint = 0;
 		reln->smgr_which = 0;	/* we only have md.c at present */
 
 		/* it is not pinned yet */
@@ -357,6 +358,7 @@ smgrrelease(SMgrRelation reln)
 		reln->smgr_cached_nblocks[forknum] = InvalidBlockNumber;
 	}
 	reln->smgr_targblock = InvalidBlockNumber;
+	reln->smgr_extend_hint = 0;
 
 	RESUME_INTERRUPTS();
 }
@@ -17,6 +17,7 @@
 #include <ctype.h>
 #include <math.h>
 
+#include "access/detoast.h"
 #include "access/transam.h"
 #include "catalog/pg_type.h"
 #include "common/int.h"
@@ -114,6 +115,10 @@ static Datum array_get_element_expanded(Datum arraydatum,
 										int arraytyplen,
 										int elmlen, bool elmbyval, char elmalign,
 										bool *isNull);
+static Datum array_get_element_sliced(struct varlena *attr,
+									  int nSubscripts, int *indx,
+									  int elmlen, bool elmbyval, char elmalign,
+									  bool *isNull);
 static Datum array_set_element_expanded(Datum arraydatum,
 										int nSubscripts, int *indx,
 										Datum dataValue, bool isNull,
@@ -1865,8 +1870,33 @@ array_get_element(Datum arraydatum,
 	}
 	else
 	{
+		ArrayType  *array;
+		struct varlena *attr = (struct varlena *) DatumGetPointer(arraydatum);
+
+		/*
+		 * For fixed-length element types stored in an out-of-line,
+		 * uncompressed datum, we can locate the element from the array
+		 * header alone and fetch just its bytes, instead of detoasting the
+		 * whole array.  (Slicing into a compressed datum would have to
+		 * decompress it from the start, so there is nothing to win there.)
+		 */
+		if (elmlen > 0 && VARATT_IS_EXTERNAL_ONDISK(attr))
+		{
+			struct varatt_external toast_pointer;
+
+			VARATT_EXTERNAL_GET_POINTER(toast_pointer, attr);
+			if (!VARATT_EXTERNAL_IS_COMPRESSED(toast_pointer))
+				return array_get_element_sliced(attr,
+												nSubscripts,
+												indx,
+												elmlen,
+												elmbyval,
+												elmalign,
+												isNull);
+		}
+
 		/* detoast array if necessary, producing normal varlena input */
-		ArrayType  *array = DatumGetArrayTypeP(arraydatum);
+		array = DatumGetArrayTypeP(arraydatum);
 
 		ndim = ARR_NDIM(array);
 		dim = ARR_DIMS(array);
@@ -1997,6 +2027,118 @@ array_get_element_expanded(Datum arraydatum,
 	return dvalues[offset];
 }
 
+/*
+ * Implementation of array_get_element() for an out-of-line, uncompressed
+ * array of fixed-length elements: fetch the array header (and the nulls
+ * bitmap, if there is one) with a sliced detoast, locate the wanted element
+ * from them, and then fetch just that element's bytes.
+ *
+ * Note that the slice offsets passed to detoast_attr_slice() are relative to
+ * the datum's data bytes, so the varlena header size must be subtracted from
+ * offsets computed in the array's own terms.
+ */
+static Datum
+array_get_element_sliced(struct varlena *attr,
+						 int nSubscripts, int *indx,
+						 int elmlen, bool elmbyval, char elmalign,
+						 bool *isNull)
+{
+	struct varlena *prefix;
+	ArrayType  *array;
+	int			i,
+				ndim,
+			   *dim,
+			   *lb,
+				offset,
+				position;
+	bits8	   *nullbitmap;
+	Size		header_size;
+	Size		elemoff;
+	struct varlena *slice;
+	char	   *elemptr;
+
+	/* Fetch the fixed-size part of the header first, to learn ndim */
+	prefix = detoast_attr_slice(attr, 0, sizeof(ArrayType) - VARHDRSZ);
+	array = (ArrayType *) prefix;
+	ndim = ARR_NDIM(array);
+	header_size = ARR_HASNULL(array) ?
+		array->dataoffset : ARR_OVERHEAD_NONULLS(ndim);
+	pfree(prefix);
+
+	/*
+	 * Return NULL for invalid subscript
+	 */
+	if (ndim != nSubscripts || ndim <= 0 || ndim > MAXDIM)
+	{
+		*isNull = true;
+		return (Datum) 0;
+	}
+
+	/* Now fetch the dimensions, bounds, and any nulls bitmap */
+	prefix = detoast_attr_slice(attr, 0, header_size - VARHDRSZ);
+	array = (ArrayType *) prefix;
+	dim = ARR_DIMS(array);
+	lb = ARR_LBOUND(array);
+	nullbitmap = ARR_NULLBITMAP(array);
+
+	for (i = 0; i < ndim; i++)
+	{
+		if (indx[i] < lb[i] || indx[i] >= (dim[i] + lb[i]))
+		{
+			pfree(prefix);
+			*isNull = true;
+			return (Datum) 0;
+		}
+	}
+
+	/*
+	 * Calculate the element number
+	 */
+	offset = ArrayGetOffset(nSubscripts, dim, lb, indx);
+
+	/*
+	 * Check for NULL array element
+	 */
+	if (array_get_isnull(nullbitmap, offset))
+	{
+		pfree(prefix);
+		*isNull = true;
+		return (Datum) 0;
+	}
+
+	/*
+	 * The element's position in the data area is its element number less the
+	 * number of preceding NULL elements, which store no bytes.
+	 */
+	if (nullbitmap)
+	{
+		position = pg_popcount((const char *) nullbitmap, offset / 8);
+		if (offset % 8 != 0)
+			position += pg_popcount32(nullbitmap[offset / 8] &
+									  ((1 << (offset % 8)) - 1));
+	}
+	else
+		position = offset;
+
+	pfree(prefix);
+
+	elemoff = position * ((Size) att_align_nominal(elmlen, elmalign));
+
+	/*
+	 * OK, fetch the element.  Copy it into a palloc'd (and therefore
+	 * maxaligned) buffer: the slice's data area only has the alignment of a
+	 * varlena payload, which is not enough for 8-byte-aligned element types.
+	 */
+	slice = detoast_attr_slice(attr, (header_size - VARHDRSZ) + elemoff,
+							   elmlen);
+	elemptr = palloc(elmlen);
+	memcpy(elemptr, VARDATA(slice), elmlen);
+	pfree(slice);
+
+	*isNull = false;
+	return ArrayCast(elemptr, elmbyval, elmlen);
+}
+
 /*
  * array_get_slice :
  *		   This routine takes an array and a range of indices (upperIndx and
@@ -5367,7 +5509,16 @@ accumArrayResult(ArrayBuildState *astate,
 
 	oldcontext = MemoryContextSwitchTo(astate->mcontext);
 
-	/* enlarge dvalues[]/dnulls[] if needed */
+	/*
+	 * Enlarge dvalues[]/dnulls[] if needed.  Doubling keeps the pointer
+	 * array copying amortized O(1) per element, and for large arrays the
+	 * underlying realloc can typically extend the block in place.  A
+	 * chunked representation would avoid even that, but every consumer of
+	 * ArrayBuildState (materialization, aggregate serialize/combine)
+	 * indexes dvalues[] flat, and the dominant per-element cost is the
+	 * one-time copy of pass-by-reference values below, which any
+	 * representation must pay.
+	 */
 	if (astate->nelems >= astate->alen)
 	{
 		astate->alen *= 2;
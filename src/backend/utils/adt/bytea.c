@@ -624,12 +624,13 @@ byteapos(PG_FUNCTION_ARGS)
 Datum
 byteaGetByte(PG_FUNCTION_ARGS)
 {
-	bytea	   *v = PG_GETARG_BYTEA_PP(0);
+	Datum		str = PG_GETARG_DATUM(0);
 	int32		n = PG_GETARG_INT32(1);
 	int			len;
 	int			byte;
+	bytea	   *slice;
 
-	len = VARSIZE_ANY_EXHDR(v);
+	len = toast_raw_datum_size(str) - VARHDRSZ;
 
 	if (n < 0 || n >= len)
 		ereport(ERROR,
@@ -637,7 +638,9 @@ byteaGetByte(PG_FUNCTION_ARGS)
 				 errmsg("index %d out of valid range, 0..%d",
 						n, len - 1)));
 
-	byte = ((unsigned char *) VARDATA_ANY(v))[n];
+	/* for a toasted input, fetch only the byte we need */
+	slice = DatumGetByteaPSlice(str, n, 1);
+	byte = ((unsigned char *) VARDATA_ANY(slice))[0];
 
 	PG_RETURN_INT32(byte);
 }
@@ -653,14 +656,15 @@ byteaGetByte(PG_FUNCTION_ARGS)
 Datum
 byteaGetBit(PG_FUNCTION_ARGS)
 {
-	bytea	   *v = PG_GETARG_BYTEA_PP(0);
+	Datum		str = PG_GETARG_DATUM(0);
 	int64		n = PG_GETARG_INT64(1);
 	int			byteNo,
 				bitNo;
 	int			len;
 	int			byte;
+	bytea	   *slice;
 
-	len = VARSIZE_ANY_EXHDR(v);
+	len = toast_raw_datum_size(str) - VARHDRSZ;
 
 	if (n < 0 || n >= (int64) len * 8)
 		ereport(ERROR,
@@ -672,7 +676,9 @@ byteaGetBit(PG_FUNCTION_ARGS)
 	byteNo = (int) (n / 8);
 	bitNo = (int) (n % 8);
 
-	byte = ((unsigned char *) VARDATA_ANY(v))[byteNo];
+	/* for a toasted input, fetch only the byte we need */
+	slice = DatumGetByteaPSlice(str, byteNo, 1);
+	byte = ((unsigned char *) VARDATA_ANY(slice))[0];
 
 	if (byte & (1 << bitNo))
 		PG_RETURN_INT32(1);
@@ -13,9 +13,12 @@
  */
 #include "postgres.h"
 
+#include "access/detoast.h"
 #include "catalog/pg_collation.h"
 #include "common/hashfn.h"
+#include "common/int.h"
 #include "miscadmin.h"
+#include "varatt.h"
 #include "port/pg_bitutils.h"
 #include "utils/datetime.h"
 #include "utils/fmgrprotos.h"
@@ -390,32 +393,26 @@ findJsonbValueFromContainer(JsonbContainer *container, uint32 flags,
 }
 
 /*
- * Find value by key in Jsonb object and fetch it into 'res', which is also
- * returned.
+ * Binary search an object container's key entries for the given key.
  *
- * 'res' can be passed in as NULL, in which case it's newly palloc'ed here.
+ * Returns the key's index within the key half of the JEntry array, or -1 if
+ * the key is not present.  The container's JEntry array and key strings must
+ * be present in memory, but this never examines any value bytes, which is
+ * what allows the sliced lookup below to search a prefix of a toasted datum.
  */
-JsonbValue *
-getKeyJsonValueFromContainer(JsonbContainer *container,
-							 const char *keyVal, int keyLen, JsonbValue *res)
+static int
+findJsonbKeyInObject(JsonbContainer *container, const char *keyVal, int keyLen)
 {
 	JEntry	   *children = container->children;
 	int			count = JsonContainerSize(container);
-	char	   *baseAddr;
+	char	   *baseAddr = (char *) (children + count * 2);
 	uint32		stopLow,
 				stopHigh;
 
-	Assert(JsonContainerIsObject(container));
-
-	/* Quick out without a palloc cycle if object is empty */
-	if (count <= 0)
-		return NULL;
-
 	/*
 	 * Binary search the container. Since we know this is an object, account
 	 * for *Pairs* of Jentrys
 	 */
-	baseAddr = (char *) (children + count * 2);
 	stopLow = 0;
 	stopHigh = count;
 	while (stopLow < stopHigh)
@@ -434,30 +431,244 @@ getKeyJsonValueFromContainer(JsonbContainer *container,
 											  keyVal, keyLen);
 
 		if (difference == 0)
-		{
-			/* Found our key, return corresponding value */
-			int			index = stopMiddle + count;
+			return stopMiddle;
+
+		if (difference < 0)
+			stopLow = stopMiddle + 1;
+		else
+			stopHigh = stopMiddle;
+	}
+
+	/* Not found */
+	return -1;
+}
+
+/*
+ * Find value by key in Jsonb object and fetch it into 'res', which is also
+ * returned.
+ *
+ * 'res' can be passed in as NULL, in which case it's newly palloc'ed here.
+ */
+JsonbValue *
+getKeyJsonValueFromContainer(JsonbContainer *container,
+							 const char *keyVal, int keyLen, JsonbValue *res)
+{
+	int			count = JsonContainerSize(container);
+	int			index;
+
+	Assert(JsonContainerIsObject(container));
 
-			if (!res)
-				res = palloc(sizeof(JsonbValue));
+	/* Quick out without a palloc cycle if object is empty */
+	if (count <= 0)
+		return NULL;
+
+	index = findJsonbKeyInObject(container, keyVal, keyLen);
+	if (index < 0)
+		return NULL;
+
+	/* Found our key, return corresponding value */
+	index += count;
+
+	if (!res)
+		res = palloc(sizeof(JsonbValue));
+
+	fillJsonbValue(container, index,
+				   (char *) (container->children + count * 2),
+				   getJsonbOffset(container, index),
+				   res);
+
+	return res;
+}
 
-			fillJsonbValue(container, index, baseAddr,
-						   getJsonbOffset(container, index),
-						   res);
+/*
+ * Like fillJsonbValue(), but works against an external on-disk datum of
+ * which only a prefix has been detoasted.  The JEntry array of 'container'
+ * (a partially fetched copy of the datum's root container) must be complete;
+ * the bytes of child 'index', which live at 'base_offset' plus the child's
+ * offset within the full datum, are fetched here with a sliced detoast.
+ */
+static void
+fillJsonbValueFromToasted(struct varlena *attr, JsonbContainer *container,
+						  int index, uint32 base_offset, JsonbValue *result)
+{
+	JEntry		entry = container->children[index];
+	uint32		offset = getJsonbOffset(container, index);
+	uint32		length = getJsonbLength(container, index);
 
-			return res;
+	if (JBE_ISNULL(entry))
+	{
+		result->type = jbvNull;
+	}
+	else if (JBE_ISBOOL_TRUE(entry))
+	{
+		result->type = jbvBool;
+		result->val.boolean = true;
+	}
+	else if (JBE_ISBOOL_FALSE(entry))
+	{
+		result->type = jbvBool;
+		result->val.boolean = false;
+	}
+	else if (JBE_ISSTRING(entry))
+	{
+		struct varlena *data;
+
+		data = detoast_attr_slice(attr, base_offset + offset, length);
+		result->type = jbvString;
+		result->val.string.val = VARDATA(data);
+		result->val.string.len = length;
+		Assert(result->val.string.len >= 0);
+	}
+	else
+	{
+		uint32		aligned = INTALIGN(offset);
+		struct varlena *data;
+
+		/*
+		 * Numeric and nested-container children are stored int-aligned
+		 * within the datum.  base_offset is a multiple of four and the
+		 * slice's data area starts on a four-byte boundary, so fetching from
+		 * the aligned offset preserves the alignment that the in-memory
+		 * forms require.
+		 */
+		data = detoast_attr_slice(attr, base_offset + aligned,
+								  length - (aligned - offset));
+		if (JBE_ISNUMERIC(entry))
+		{
+			result->type = jbvNumeric;
+			result->val.numeric = (Numeric) VARDATA(data);
 		}
 		else
 		{
-			if (difference < 0)
-				stopLow = stopMiddle + 1;
-			else
-				stopHigh = stopMiddle;
+			Assert(JBE_ISCONTAINER(entry));
+			result->type = jbvBinary;
+			result->val.binary.data = (JsonbContainer *) VARDATA(data);
+			result->val.binary.len = length - (aligned - offset);
 		}
 	}
+}
 
-	/* Not found */
-	return NULL;
+/*
+ * Like getKeyJsonValueFromContainer(), but works directly on an external,
+ * uncompressed on-disk jsonb datum, detoasting only the chunks the lookup
+ * needs.
+ *
+ * A serialized jsonb object lays out its container header, its JEntry array
+ * and all of its key strings ahead of any of its values.  We can therefore
+ * fetch that prefix, binary search it for the key, and then fetch just the
+ * byte range holding the corresponding value.  For wide datums this reads a
+ * small fraction of the TOAST chunks; the chunks holding the prefix are
+ * visited up to twice more, but will normally still be in shared buffers.
+ *
+ * The caller must have checked that the datum is VARATT_EXTERNAL_ONDISK and
+ * not compressed (slicing into the middle of a compressed datum would have
+ * to decompress it from the start, nullifying the savings).  A datum whose
+ * root is not an object yields NULL, same as an absent key.
+ */
+JsonbValue *
+getKeyJsonValueFromToastedObject(struct varlena *attr, const char *keyVal,
+								 int keyLen, JsonbValue *res)
+{
+	struct varlena *prefix;
+	JsonbContainer *container;
+	uint32		header;
+	uint32		count;
+	uint32		base_offset;
+	uint32		keys_end;
+	int			index;
+
+	Assert(VARATT_IS_EXTERNAL_ONDISK(attr));
+
+	/* Read the container header to learn the root's type and size */
+	prefix = detoast_attr_slice(attr, 0, sizeof(uint32));
+	header = ((JsonbContainer *) VARDATA(prefix))->header;
+	pfree(prefix);
+
+	count = header & JB_CMASK;
+	if ((header & JB_FOBJECT) == 0 || count == 0)
+		return NULL;
+
+	/*
+	 * Fetch the JEntry array, and from it compute where the key strings end:
+	 * that is the start offset of the object's first value.  Then fetch the
+	 * full lookup prefix.
+	 */
+	base_offset = offsetof(JsonbContainer, children) +
+		sizeof(JEntry) * count * 2;
+	prefix = detoast_attr_slice(attr, 0, base_offset);
+	container = (JsonbContainer *) VARDATA(prefix);
+	keys_end = getJsonbOffset(container, count);
+	pfree(prefix);
+
+	prefix = detoast_attr_slice(attr, 0, base_offset + keys_end);
+	container = (JsonbContainer *) VARDATA(prefix);
+
+	index = findJsonbKeyInObject(container, keyVal, keyLen);
+	if (index < 0)
+	{
+		pfree(prefix);
+		return NULL;
+	}
+
+	if (!res)
+		res = palloc(sizeof(JsonbValue));
+
+	/* Found our key, fetch the bytes of the corresponding value */
+	fillJsonbValueFromToasted(attr, container, index + count, base_offset,
+							  res);
+
+	pfree(prefix);
+	return res;
+}
+
+/*
+ * Like getIthJsonbValueFromContainer(), but works directly on an external,
+ * uncompressed on-disk jsonb datum; see getKeyJsonValueFromToastedObject().
+ * Negative subscripts count from the end of the array, as in
+ * jsonb_array_element().  A datum whose root is not an array yields NULL.
+ */
+JsonbValue *
+getIthJsonbValueFromToastedArray(struct varlena *attr, int element)
+{
+	struct varlena *prefix;
+	JsonbContainer *container;
+	uint32		header;
+	uint32		count;
+	uint32		base_offset;
+	JsonbValue *result;
+
+	Assert(VARATT_IS_EXTERNAL_ONDISK(attr));
+
+	/* Read the container header to learn the root's type and size */
+	prefix = detoast_attr_slice(attr, 0, sizeof(uint32));
+	header = ((JsonbContainer *) VARDATA(prefix))->header;
+	pfree(prefix);
+
+	count = header & JB_CMASK;
+	if ((header & JB_FARRAY) == 0)
+		return NULL;
+
+	/* Handle negative subscript */
+	if (element < 0)
+	{
+		if (pg_abs_s32(element) > count)
+			return NULL;
+		element += count;
+	}
+
+	if ((uint32) element >= count)
+		return NULL;
+
+	/* Fetch the JEntry array, and then the bytes of the element */
+	base_offset = offsetof(JsonbContainer, children) + sizeof(JEntry) * count;
+	prefix = detoast_attr_slice(attr, 0, base_offset);
+	container = (JsonbContainer *) VARDATA(prefix);
+
+	result = palloc(sizeof(JsonbValue));
+	fillJsonbValueFromToasted(attr, container, element, base_offset, result);
+
+	pfree(prefix);
+	return result;
 }
 
 /*
@@ -16,6 +16,7 @@
 
 #include <limits.h>
 
+#include "access/detoast.h"
 #include "access/htup_details.h"
 #include "catalog/pg_type.h"
 #include "common/int.h"
@@ -39,6 +40,7 @@
 #include "utils/memutils.h"
 #include "utils/syscache.h"
 #include "utils/typcache.h"
+#include "varatt.h"
 
 /* Operations available for setPath */
 #define JB_PATH_CREATE					0x0001
@@ -858,21 +860,58 @@ json_object_field(PG_FUNCTION_ARGS)
 		PG_RETURN_NULL();
 }
 
+/*
+ * Can a single-element lookup into this jsonb datum use the sliced-detoast
+ * fast path of getKeyJsonValueFromToastedObject() et al?
+ *
+ * Only out-of-line, uncompressed datums qualify: anything in-line is already
+ * in memory, and slicing into the middle of a compressed datum means
+ * decompressing it from the start anyway.
+ */
+static bool
+jsonb_use_sliced_lookup(Datum jsonbdatum)
+{
+	struct varlena *attr = (struct varlena *) DatumGetPointer(jsonbdatum);
+
+	if (VARATT_IS_EXTERNAL_ONDISK(attr))
+	{
+		struct varatt_external toast_pointer;
+
+		VARATT_EXTERNAL_GET_POINTER(toast_pointer, attr);
+
+		return !VARATT_EXTERNAL_IS_COMPRESSED(toast_pointer);
+	}
+
+	return false;
+}
+
 Datum
 jsonb_object_field(PG_FUNCTION_ARGS)
 {
-	Jsonb	   *jb = PG_GETARG_JSONB_P(0);
+	Jsonb	   *jb;
 	text	   *key = PG_GETARG_TEXT_PP(1);
 	JsonbValue *v;
 	JsonbValue	vbuf;
 
-	if (!JB_ROOT_IS_OBJECT(jb))
-		PG_RETURN_NULL();
+	if (jsonb_use_sliced_lookup(PG_GETARG_DATUM(0)))
+	{
+		v = getKeyJsonValueFromToastedObject((struct varlena *) PG_GETARG_POINTER(0),
+											 VARDATA_ANY(key),
+											 VARSIZE_ANY_EXHDR(key),
+											 &vbuf);
+	}
+	else
+	{
+		jb = PG_GETARG_JSONB_P(0);
+
+		if (!JB_ROOT_IS_OBJECT(jb))
+			PG_RETURN_NULL();
 
-	v = getKeyJsonValueFromContainer(&jb->root,
-									 VARDATA_ANY(key),
-									 VARSIZE_ANY_EXHDR(key),
-									 &vbuf);
+		v = getKeyJsonValueFromContainer(&jb->root,
+										 VARDATA_ANY(key),
+										 VARSIZE_ANY_EXHDR(key),
+										 &vbuf);
+	}
 
 	if (v != NULL)
 		PG_RETURN_JSONB_P(JsonbValueToJsonb(v));
@@ -899,18 +938,30 @@ json_object_field_text(PG_FUNCTION_ARGS)
 Datum
 jsonb_object_field_text(PG_FUNCTION_ARGS)
 {
-	Jsonb	   *jb = PG_GETARG_JSONB_P(0);
+	Jsonb	   *jb;
 	text	   *key = PG_GETARG_TEXT_PP(1);
 	JsonbValue *v;
 	JsonbValue	vbuf;
 
-	if (!JB_ROOT_IS_OBJECT(jb))
-		PG_RETURN_NULL();
+	if (jsonb_use_sliced_lookup(PG_GETARG_DATUM(0)))
+	{
+		v = getKeyJsonValueFromToastedObject((struct varlena *) PG_GETARG_POINTER(0),
+											 VARDATA_ANY(key),
+											 VARSIZE_ANY_EXHDR(key),
+											 &vbuf);
+	}
+	else
+	{
+		jb = PG_GETARG_JSONB_P(0);
 
-	v = getKeyJsonValueFromContainer(&jb->root,
-									 VARDATA_ANY(key),
-									 VARSIZE_ANY_EXHDR(key),
-									 &vbuf);
+		if (!JB_ROOT_IS_OBJECT(jb))
+			PG_RETURN_NULL();
+
+		v = getKeyJsonValueFromContainer(&jb->root,
+										 VARDATA_ANY(key),
+										 VARSIZE_ANY_EXHDR(key),
+										 &vbuf);
+	}
 
 	if (v != NULL && v->type != jbvNull)
 		PG_RETURN_TEXT_P(JsonbValueAsText(v));
@@ -936,25 +987,36 @@ json_array_element(PG_FUNCTION_ARGS)
 Datum
 jsonb_array_element(PG_FUNCTION_ARGS)
 {
-	Jsonb	   *jb = PG_GETARG_JSONB_P(0);
+	Jsonb	   *jb;
 	int			element = PG_GETARG_INT32(1);
 	JsonbValue *v;
 
-	if (!JB_ROOT_IS_ARRAY(jb))
-		PG_RETURN_NULL();
-
-	/* Handle negative subscript */
-	if (element < 0)
+	if (jsonb_use_sliced_lookup(PG_GETARG_DATUM(0)))
 	{
-		uint32		nelements = JB_ROOT_COUNT(jb);
+		v = getIthJsonbValueFromToastedArray((struct varlena *) PG_GETARG_POINTER(0),
+											 element);
+	}
+	else
+	{
+		jb = PG_GETARG_JSONB_P(0);
 
-		if (pg_abs_s32(element) > nelements)
+		if (!JB_ROOT_IS_ARRAY(jb))
 			PG_RETURN_NULL();
-		else
-			element += nelements;
+
+		/* Handle negative subscript */
+		if (element < 0)
+		{
+			uint32		nelements = JB_ROOT_COUNT(jb);
+
+			if (pg_abs_s32(element) > nelements)
+				PG_RETURN_NULL();
+			else
+				element += nelements;
+		}
+
+		v = getIthJsonbValueFromContainer(&jb->root, element);
 	}
 
-	v = getIthJsonbValueFromContainer(&jb->root, element);
 	if (v != NULL)
 		PG_RETURN_JSONB_P(JsonbValueToJsonb(v));
 
@@ -979,25 +1041,35 @@ json_array_element_text(PG_FUNCTION_ARGS)
 Datum
 jsonb_array_element_text(PG_FUNCTION_ARGS)
 {
-	Jsonb	   *jb = PG_GETARG_JSONB_P(0);
+	Jsonb	   *jb;
 	int			element = PG_GETARG_INT32(1);
 	JsonbValue *v;
 
-	if (!JB_ROOT_IS_ARRAY(jb))
-		PG_RETURN_NULL();
-
-	/* Handle negative subscript */
-	if (element < 0)
+	if (jsonb_use_sliced_lookup(PG_GETARG_DATUM(0)))
 	{
-		uint32		nelements = JB_ROOT_COUNT(jb);
+		v = getIthJsonbValueFromToastedArray((struct varlena *) PG_GETARG_POINTER(0),
+											 element);
+	}
+	else
+	{
+		jb = PG_GETARG_JSONB_P(0);
 
-		if (pg_abs_s32(element) > nelements)
+		if (!JB_ROOT_IS_ARRAY(jb))
 			PG_RETURN_NULL();
-		else
-			element += nelements;
-	}
 
-	v = getIthJsonbValueFromContainer(&jb->root, element);
+		/* Handle negative subscript */
+		if (element < 0)
+		{
+			uint32		nelements = JB_ROOT_COUNT(jb);
+
+			if (pg_abs_s32(element) > nelements)
+				PG_RETURN_NULL();
+			else
+				element += nelements;
+		}
+
+		v = getIthJsonbValueFromContainer(&jb->root, element);
+	}
 
 	if (v != NULL && v->type != jbvNull)
 		PG_RETURN_TEXT_P(JsonbValueAsText(v));
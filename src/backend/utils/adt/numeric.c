@@ -4733,6 +4733,17 @@ typedef struct NumericAggState
 	int64		NaNcount;		/* count of NaN values */
 	int64		pInfcount;		/* count of +Inf values */
 	int64		nInfcount;		/* count of -Inf values */
+
+	/*
+	 * Fast-path accumulator, used only when !calcSumX2.  Input values narrow
+	 * enough to be represented exactly as 128-bit integers scaled by a fixed
+	 * power of NBASE are summed here without touching the digit buffers; the
+	 * total is spilled into sumX whenever it could otherwise overflow, or
+	 * whenever sumX needs to be examined.  See numeric_fastsum_add().
+	 */
+	INT128		fastSum;		/* partial sum, scaled by NBASE^fastScale */
+	int			fastScale;		/* scale of fastSum, in NBASE digits */
+	int			fastDscale;		/* maximum dscale among fastSum's inputs */
 } NumericAggState;
 
 #define NA_TOTAL_COUNT(na) \
@@ -4779,6 +4790,129 @@ makeNumericAggStateCurrentContext(bool calcSumX2)
 	return state;
 }
 
+/*
+ * Spill the fast-path 128-bit partial sum into state->sumX.
+ *
+ * This must be done before reading sumX directly, and before merging or
+ * serializing the accumulator.
+ */
+static void
+numeric_fastsum_flush(NumericAggState *state)
+{
+	MemoryContext old_context;
+	NumericVar	tmp;
+
+	/*
+	 * Even if the sum is zero, it must be spilled when it has a nonzero
+	 * dscale, so that the dscale carries over to sumX: the sum of "0.000"
+	 * values is "0.000", not "0".
+	 */
+	if (!int128_is_zero(state->fastSum) || state->fastDscale > 0)
+	{
+		/*
+		 * accum_sum_add() can enlarge the accumulator's digit buffers, which
+		 * must live in the aggregate context.  Some callers of this function
+		 * (e.g. the serialization functions) don't switch contexts, so do it
+		 * here.
+		 */
+		old_context = MemoryContextSwitchTo(state->agg_context);
+
+		init_var(&tmp);
+		int128_to_numericvar(state->fastSum, &tmp);
+		tmp.weight -= state->fastScale;
+		tmp.dscale = state->fastDscale;
+		accum_sum_add(&state->sumX, &tmp);
+		free_var(&tmp);
+
+		state->fastSum = int64_to_int128(0);
+
+		MemoryContextSwitchTo(old_context);
+	}
+
+	state->fastScale = 0;
+	state->fastDscale = 0;
+}
+
+/*
+ * Attempt to add a value to (or, if subtract is true, remove it from) the
+ * fast-path 128-bit sum.
+ *
+ * The sum is kept scaled by a fixed power of NBASE, chosen as the smallest
+ * that makes all the values seen so far integral; when a value with a larger
+ * dscale arrives, the old partial sum is first flushed into sumX.  Returns
+ * false if the value is too wide for this representation, in which case the
+ * caller must fall back to accum_sum_add().
+ */
+static bool
+numeric_fastsum_add(NumericAggState *state, const NumericVar *X, bool subtract)
+{
+	int			xscale;
+	int			ndigits;
+	int			hndigits;
+	int64		hi = 0;
+	int64		lo = 0;
+	int			i;
+
+	/* The value's scale in whole NBASE digits, rounded up */
+	xscale = (X->dscale + DEC_DIGITS - 1) / DEC_DIGITS;
+
+	/*
+	 * Scaled by NBASE^max(xscale, fastScale), the value occupies this many
+	 * NBASE digits.  Cap that at 8 digits (at most 32 decimal digits), so
+	 * that we can build the scaled value from two int64 halves of at most 4
+	 * NBASE digits each, and so that additions cannot overflow the int128
+	 * sum between the flush checks below.
+	 */
+	ndigits = X->weight + 1 + Max(xscale, state->fastScale);
+	if (ndigits > 8 || X->ndigits > ndigits)
+		return false;
+
+	/* Adopt a larger scale, flushing anything summed at the old one */
+	if (xscale > state->fastScale)
+	{
+		numeric_fastsum_flush(state);
+		state->fastScale = xscale;
+	}
+
+	hndigits = ndigits - 4;
+	for (i = 0; i < ndigits; i++)
+	{
+		int64		d = (i < X->ndigits) ? X->digits[i] : 0;
+
+		if (i < hndigits)
+			hi = hi * NBASE + d;
+		else
+			lo = lo * NBASE + d;
+	}
+
+	if ((X->sign == NUMERIC_NEG) != subtract)
+	{
+		hi = -hi;
+		lo = -lo;
+	}
+
+	/* value = hi * NBASE^4 + lo */
+	int128_add_int64(&state->fastSum, lo);
+	if (hi != 0)
+		int128_add_int64_mul_int64(&state->fastSum, hi,
+								   (int64) NBASE * NBASE * NBASE * NBASE);
+
+	if (X->dscale > state->fastDscale)
+		state->fastDscale = X->dscale;
+
+	/*
+	 * Flush once the high half of the sum reaches 2^56 in magnitude.  Below
+	 * that, |fastSum| < 2^120, and since each scaled value is less than
+	 * 10^32 < 2^107, the additions above cannot have overflowed, nor can the
+	 * next ones before this check runs again.
+	 */
+	hi = PG_INT128_HI_INT64(state->fastSum);
+	if (hi >= (INT64CONST(1) << 56) || hi <= -(INT64CONST(1) << 56))
+		numeric_fastsum_flush(state);
+
+	return true;
+}
+
 /*
  * Accumulate a new input value for numeric aggregate functions.
  */
@@ -4828,8 +4962,9 @@ do_numeric_accum(NumericAggState *state, Numeric newval)
 
 	state->N++;
 
-	/* Accumulate sums */
-	accum_sum_add(&(state->sumX), &X);
+	/* Accumulate sums, using the fast path if the value is narrow enough */
+	if (state->calcSumX2 || !numeric_fastsum_add(state, &X, false))
+		accum_sum_add(&(state->sumX), &X);
 
 	if (state->calcSumX2)
 		accum_sum_add(&(state->sumX2), &X2);
@@ -4916,9 +5051,12 @@ do_numeric_discard(NumericAggState *state, Numeric newval)
 
 	if (state->N-- > 1)
 	{
-		/* Negate X, to subtract it from the sum */
-		X.sign = (X.sign == NUMERIC_POS ? NUMERIC_NEG : NUMERIC_POS);
-		accum_sum_add(&(state->sumX), &X);
+		if (state->calcSumX2 || !numeric_fastsum_add(state, &X, true))
+		{
+			/* Negate X, to subtract it from the sum */
+			X.sign = (X.sign == NUMERIC_POS ? NUMERIC_NEG : NUMERIC_POS);
+			accum_sum_add(&(state->sumX), &X);
+		}
 
 		if (state->calcSumX2)
 		{
@@ -4932,6 +5070,9 @@ do_numeric_discard(NumericAggState *state, Numeric newval)
 		/* Zero the sums */
 		Assert(state->N == 0);
 
+		state->fastSum = int64_to_int128(0);
+		state->fastScale = 0;
+		state->fastDscale = 0;
 		accum_sum_reset(&state->sumX);
 		if (state->calcSumX2)
 			accum_sum_reset(&state->sumX2);
@@ -5074,6 +5215,9 @@ numeric_avg_combine(PG_FUNCTION_ARGS)
 	if (state2 == NULL)
 		PG_RETURN_POINTER(state1);
 
+	/* ensure state2's sum is all in its sumX accumulator */
+	numeric_fastsum_flush(state2);
+
 	/* manually copy all fields from state2 to state1 */
 	if (state1 == NULL)
 	{
@@ -5151,6 +5295,7 @@ numeric_avg_serialize(PG_FUNCTION_ARGS)
 	pq_sendint64(&buf, state->N);
 
 	/* sumX */
+	numeric_fastsum_flush(state);
 	accum_sum_final(&state->sumX, &tmp_var);
 	numericvar_serialize(&buf, &tmp_var);
 
@@ -5942,6 +6087,8 @@ numeric_avg(PG_FUNCTION_ARGS)
 
 	N_datum = NumericGetDatum(int64_to_numeric(state->N));
 
+	numeric_fastsum_flush(state);
+
 	init_var(&sumX_var);
 	accum_sum_final(&state->sumX, &sumX_var);
 	sumX_datum = NumericGetDatum(make_result(&sumX_var));
@@ -5974,6 +6121,8 @@ numeric_sum(PG_FUNCTION_ARGS)
 	if (state->nInfcount > 0)
 		PG_RETURN_NUMERIC(make_result(&const_ninf));
 
+	numeric_fastsum_flush(state);
+
 	init_var(&sumX_var);
 	accum_sum_final(&state->sumX, &sumX_var);
 	result = make_result(&sumX_var);
@@ -122,6 +122,30 @@ CppConcat(pg_stat_get_,stat)(PG_FUNCTION_ARGS)					\
 	PG_RETURN_FLOAT8(result);									\
 }
 
+/*
+ * Macro for defining float8 functions whose input is a relation's stats
+ * entry and whose counter is stored in microseconds, returned in
+ * milliseconds.
+ */
+#define PG_STAT_GET_RELENTRY_FLOAT8_MS(stat)					\
+Datum															\
+CppConcat(pg_stat_get_,stat)(PG_FUNCTION_ARGS)					\
+{																\
+	Oid			relid = PG_GETARG_OID(0);						\
+	double		result;											\
+	PgStat_StatTabEntry *tabentry;								\
+																\
+	if ((tabentry = pgstat_fetch_stat_tabentry(relid)) == NULL)	\
+		result = 0;												\
+	else														\
+		result = ((double) tabentry->stat) / 1000.0;			\
+																\
+	PG_RETURN_FLOAT8(result);									\
+}
+
+/* pg_stat_get_blk_read_time */
+PG_STAT_GET_RELENTRY_FLOAT8_MS(blk_read_time)
+
 /* pg_stat_get_total_vacuum_time */
 PG_STAT_GET_RELENTRY_FLOAT8(total_vacuum_time)
 
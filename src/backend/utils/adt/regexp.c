@@ -90,9 +90,19 @@ typedef struct regexp_matches_ctx
  * the cache as long as it's used at least once in every MAX_CACHED_RES uses.
  */
 
-/* this is the maximum number of cached regular expressions */
+/*
+ * This is the maximum number of cached regular expressions.  The cache is
+ * consulted by linear search, but comparing a pattern string is so much
+ * cheaper than recompiling it that a larger cache wins for workloads
+ * cycling through many distinct patterns; the practical bound is memory,
+ * since a compiled expression (and the DFA space its execution builds up)
+ * can run to tens of kilobytes.  The cache must stay per-backend, because
+ * compiled form is full of pointers and is mutated during execution as
+ * DFA states are materialized and recycled, so it cannot live in shared
+ * memory.
+ */
 #ifndef MAX_CACHED_RES
-#define MAX_CACHED_RES	32
+#define MAX_CACHED_RES	128
 #endif
 
 /* A parent memory context for regular expressions. */
@@ -243,6 +243,19 @@ pg_noreturn static void ri_ReportViolation(const RI_ConstraintInfo *riinfo,
  * RI_FKey_check -
  *
  * Check foreign key existence (combined for INSERT and UPDATE).
+ *
+ * A per-transaction cache of already-validated referenced keys, letting
+ * repeated inserts of the same parent key skip the query, looks attractive
+ * but the query does more than look the key up: its FOR KEY SHARE locks the
+ * referenced row, and that lock is what stops a concurrent transaction from
+ * deleting the parent out from under us.  A cache hit could only be trusted
+ * while this transaction still holds that lock, so entries would have to be
+ * invalidated on our own updates/deletes of the referenced table and on
+ * subtransaction abort (which releases the lock) — bookkeeping the existing
+ * invalidation machinery doesn't provide.  Validating a statement's distinct
+ * keys in one set-oriented query is likewise how ALTER TABLE ADD FOREIGN KEY
+ * already works (see RI_Initial_Check); doing it for ordinary DML would
+ * require batching the per-row trigger events first (see trigger.c).
  */
 static Datum
 RI_FKey_check(TriggerData *trigdata)
@@ -40,6 +40,7 @@
 #include "utils/rel.h"
 #include "utils/resowner.h"
 #include "utils/syscache.h"
+#include "utils/timestamp.h"
 
 /*
  * If a catcache invalidation is processed while we are in the middle of
@@ -80,6 +81,13 @@ static CatCInProgress *catcache_in_progress_stack = NULL;
 #define CACHE_elog(...)
 #endif
 
+/*
+ * GUC: minimum number of seconds a catcache entry must go unused before it
+ * can be pruned when a cache is about to be enlarged; -1 disables pruning,
+ * so entries live for the life of the backend as they historically have.
+ */
+int			catalog_cache_prune_min_age = -1;
+
 /* Cache management header --- pointer is NULL until created */
 static CatCacheHeader *CacheHdr = NULL;
 
@@ -108,6 +116,7 @@ static void CatCachePrintStats(int code, Datum arg);
 #endif
 static void CatCacheRemoveCTup(CatCache *cache, CatCTup *ct);
 static void CatCacheRemoveCList(CatCache *cache, CatCList *cl);
+static bool CatCacheCleanupOldEntries(CatCache *cp);
 static void RehashCatCache(CatCache *cp);
 static void RehashCatCacheLists(CatCache *cp);
 static void CatalogCacheInitializeCache(CatCache *cache);
@@ -985,6 +994,57 @@ InitCatCache(int id,
 	return cp;
 }
 
+/*
+ * Prune entries that have gone unused for at least
+ * catalog_cache_prune_min_age seconds.  This is called when a catcache is
+ * about to be enlarged; returns true if enough entries were removed that
+ * the enlargement can be skipped.  The point is to bound the memory used by
+ * a backend that touches a great many catalog rows only transiently, such
+ * as one serving many schemas through a connection pooler.
+ *
+ * Entries that are currently referenced, already dead, or members of a
+ * CatCList are never removed here; list members age out only when the whole
+ * list is invalidated, which keeps the bookkeeping simple at some cost in
+ * precision.
+ */
+static bool
+CatCacheCleanupOldEntries(CatCache *cp)
+{
+	TimestampTz now;
+	int			nremoved = 0;
+
+	if (catalog_cache_prune_min_age < 0)
+		return false;
+
+	now = GetCurrentTimestamp();
+
+	for (int i = 0; i < cp->cc_nbuckets; i++)
+	{
+		dlist_mutable_iter iter;
+
+		dlist_foreach_modify(iter, &cp->cc_bucket[i])
+		{
+			CatCTup    *ct = dlist_container(CatCTup, cache_elem, iter.cur);
+
+			if (ct->refcount != 0 || ct->dead || ct->c_list != NULL)
+				continue;
+
+			if (TimestampDifferenceExceedsSeconds(ct->lastaccess, now,
+												  catalog_cache_prune_min_age))
+			{
+				CatCacheRemoveCTup(cp, ct);
+				nremoved++;
+			}
+		}
+	}
+
+	CACHE_elog(DEBUG2, "CatCacheCleanupOldEntries(%s): removed %d tuples, %d remain",
+			   cp->cc_relname, nremoved, cp->cc_ntup);
+
+	/* Did we get back under the fill factor that triggers enlargement? */
+	return (cp->cc_ntup <= cp->cc_nbuckets * 2);
+}
+
 /*
  * Enlarge a catcache, doubling the number of buckets.
  */
@@ -1460,6 +1520,13 @@ SearchCatCacheInternal(CatCache *cache,
 		 */
 		dlist_move_head(bucket, &ct->cache_elem);
 
+		/*
+		 * Record the access for pruning purposes.  The statement start
+		 * timestamp is plenty accurate for an aging threshold measured in
+		 * seconds, and avoids a clock read on this hot path.
+		 */
+		ct->lastaccess = GetCurrentStatementStartTimestamp();
+
 		/*
 		 * If it's a positive entry, bump its refcount and return it. If it's
 		 * negative, we can report failure to the caller.
@@ -1501,6 +1568,16 @@ SearchCatCacheInternal(CatCache *cache,
  * This is kept separate from SearchCatCacheInternal() to keep the fast-path
  * as small as possible.  To avoid that effort being undone by a helpful
  * compiler, try to explicitly forbid inlining.
+ *
+ * Note that one index scan per missing entry is less of a problem than it
+ * may look.  The bulk consumers already batch at a different level:
+ * relcache builds range-scan pg_attribute directly into the tupledesc
+ * (RelationBuildTupleDesc) without creating per-row cache entries, and
+ * whole-group lookups go through SearchCatCacheList, which fills all member
+ * entries from a single scan.  Prefilling the catcache from those scans
+ * would mostly pin memory for rows that are never looked up individually —
+ * for a schema with 200k tables, that's millions of pg_attribute entries —
+ * so a cache miss here should stay the retail path.
  */
 static pg_noinline HeapTuple
 SearchCatCacheMiss(CatCache *cache,
@@ -2265,6 +2342,7 @@ CatalogCacheCreateEntry(CatCache *cache, HeapTuple ntp, Datum *arguments,
 	ct->dead = false;
 	ct->negative = (ntp == NULL);
 	ct->hash_value = hashValue;
+	ct->lastaccess = GetCurrentStatementStartTimestamp();
 
 	dlist_push_head(&cache->cc_bucket[hashIndex], &ct->cache_elem);
 
@@ -2273,9 +2351,11 @@ CatalogCacheCreateEntry(CatCache *cache, HeapTuple ntp, Datum *arguments,
 
 	/*
 	 * If the hash table has become too full, enlarge the buckets array. Quite
-	 * arbitrarily, we enlarge when fill factor > 2.
+	 * arbitrarily, we enlarge when fill factor > 2.  First give pruning a
+	 * chance to make room instead, if it's enabled.
 	 */
-	if (cache->cc_ntup > cache->cc_nbuckets * 2)
+	if (cache->cc_ntup > cache->cc_nbuckets * 2 &&
+		!CatCacheCleanupOldEntries(cache))
 		RehashCatCache(cache);
 
 	return ct;
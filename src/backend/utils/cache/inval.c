@@ -102,6 +102,18 @@
  *	support the decoding of the in-progress transactions.  See
  *	CommandEndInvalidationMessages.
  *
+ *	Note that this machinery tracks only changes to *catalog* state, not to
+ *	user data: a plain INSERT/UPDATE/DELETE generates no invalidation
+ *	traffic at all.  It has occasionally been proposed to piggyback
+ *	relation-level "data changed" bumps on this stream at commit time, to
+ *	drive caches of query results or derived data.  Don't go there: that
+ *	would add a message per modified relation to every DML transaction,
+ *	and on a busy system the resulting SI queue traffic forces queue
+ *	overflows and cache-reset storms for all backends, penalizing everyone
+ *	to benefit the few would-be cache consumers.  Consumers that need
+ *	data-change notification should use their own channels (triggers,
+ *	logical decoding) rather than this one.
+ *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
@@ -88,6 +88,19 @@ static dlist_head saved_plan_list = DLIST_STATIC_INIT(saved_plan_list);
  */
 static dlist_head cached_expression_list = DLIST_STATIC_INIT(cached_expression_list);
 
+/*
+ * Summary filter of the relation OIDs that saved plans and cached
+ * expressions depend on, so that PlanCacheRelCallback can skip walking the
+ * whole saved_plan_list for invalidations of unrelated relations.  Each
+ * dependency OID sets one bit of the mask; bits are added whenever
+ * dependencies are (re)extracted, and the mask is recomputed from scratch
+ * during each full list walk, so stale bits decay instead of accumulating
+ * forever.  A false positive just means one unnecessary walk.
+ */
+static uint64 plancache_relid_summary = 0;
+
+#define PlanCacheRelidBit(relid)  (UINT64CONST(1) << ((relid) % 64))
+
 static void ReleaseGenericPlan(CachedPlanSource *plansource);
 static bool StmtPlanRequiresRevalidation(CachedPlanSource *plansource);
 static bool BuildingPlanRequiresSnapshot(CachedPlanSource *plansource);
@@ -105,6 +118,7 @@ static void AcquirePlannerLocks(List *stmt_list, bool acquire);
 static void ScanQueryForLocks(Query *parsetree, bool acquire);
 static bool ScanQueryWalker(Node *node, bool *acquire);
 static TupleDesc PlanCacheComputeResultDesc(List *stmt_list);
+static void PlanCacheSummaryAddOids(List *relationOids);
 static void PlanCacheRelCallback(Datum arg, Oid relid);
 static void PlanCacheObjectCallback(Datum arg, int cacheid, uint32 hashvalue);
 static void PlanCacheSysCallback(Datum arg, int cacheid, uint32 hashvalue);
@@ -447,6 +461,8 @@ CompleteCachedPlan(CachedPlanSource *plansource,
 								   &plansource->invalItems,
 								   &plansource->dependsOnRLS);
 
+		PlanCacheSummaryAddOids(plansource->relationOids);
+
 		/* Update RLS info as well. */
 		plansource->rewriteRoleId = GetUserId();
 		plansource->rewriteRowSecurity = row_security;
@@ -903,6 +919,8 @@ RevalidateCachedQuery(CachedPlanSource *plansource,
 							   &plansource->invalItems,
 							   &plansource->dependsOnRLS);
 
+	PlanCacheSummaryAddOids(plansource->relationOids);
+
 	/* Update RLS info as well. */
 	plansource->rewriteRoleId = GetUserId();
 	plansource->rewriteRowSecurity = row_security;
@@ -1142,6 +1160,13 @@ BuildCachedPlan(CachedPlanSource *plansource, List *qlist,
 			is_transient = true;
 		if (plannedstmt->dependsOnRole)
 			plan->dependsOnRole = true;
+
+		/*
+		 * The plan may depend on more relations than the querytree does
+		 * (e.g. partitions selected by the planner), so feed its dependency
+		 * list into the invalidation summary filter as well.
+		 */
+		PlanCacheSummaryAddOids(plannedstmt->relationOids);
 	}
 	if (is_transient)
 	{
@@ -1726,6 +1751,7 @@ CopyCachedPlan(CachedPlanSource *plansource)
 	MemoryContextSwitchTo(querytree_context);
 	newsource->query_list = copyObject(plansource->query_list);
 	newsource->relationOids = copyObject(plansource->relationOids);
+	PlanCacheSummaryAddOids(newsource->relationOids);
 	newsource->invalItems = copyObject(plansource->invalItems);
 	if (plansource->search_path)
 		newsource->search_path = CopySearchPathMatcher(plansource->search_path);
@@ -1845,6 +1871,7 @@ GetCachedExpression(Node *expr)
 	cexpr->expr = copyObject(expr);
 	cexpr->is_valid = true;
 	cexpr->relationOids = copyObject(relationOids);
+	PlanCacheSummaryAddOids(cexpr->relationOids);
 	cexpr->invalItems = copyObject(invalItems);
 	cexpr->context = cexpr_context;
 
@@ -2110,6 +2137,19 @@ PlanCacheComputeResultDesc(List *stmt_list)
 	return NULL;
 }
 
+/*
+ * PlanCacheSummaryAddOids
+ *		Merge a dependency OID list into the relid summary filter
+ */
+static void
+PlanCacheSummaryAddOids(List *relationOids)
+{
+	ListCell   *lc;
+
+	foreach(lc, relationOids)
+		plancache_relid_summary |= PlanCacheRelidBit(lfirst_oid(lc));
+}
+
 /*
  * PlanCacheRelCallback
  *		Relcache inval callback function
@@ -2121,6 +2161,15 @@ static void
 PlanCacheRelCallback(Datum arg, Oid relid)
 {
 	dlist_iter	iter;
+	uint64		new_summary = 0;
+
+	/*
+	 * Quick exit if nothing we cache can depend on this relation.  This
+	 * keeps sinval storms from costing O(saved plans) per message.
+	 */
+	if (relid != InvalidOid &&
+		(plancache_relid_summary & PlanCacheRelidBit(relid)) == 0)
+		return;
 
 	dlist_foreach(iter, &saved_plan_list)
 	{
@@ -2172,6 +2221,29 @@ PlanCacheRelCallback(Datum arg, Oid relid)
 				}
 			}
 		}
+
+		/* accumulate the refreshed summary from what remains valid */
+		if (plansource->is_valid)
+		{
+			ListCell   *lc;
+
+			foreach(lc, plansource->relationOids)
+				new_summary |= PlanCacheRelidBit(lfirst_oid(lc));
+
+			if (plansource->gplan && plansource->gplan->is_valid)
+			{
+				foreach(lc, plansource->gplan->stmt_list)
+				{
+					PlannedStmt *plannedstmt = lfirst_node(PlannedStmt, lc);
+					ListCell   *lc2;
+
+					if (plannedstmt->commandType == CMD_UTILITY)
+						continue;
+					foreach(lc2, plannedstmt->relationOids)
+						new_summary |= PlanCacheRelidBit(lfirst_oid(lc2));
+				}
+			}
+		}
 	}
 
 	/* Likewise check cached expressions */
@@ -2191,7 +2263,21 @@ PlanCacheRelCallback(Datum arg, Oid relid)
 		{
 			cexpr->is_valid = false;
 		}
+
+		if (cexpr->is_valid)
+		{
+			ListCell   *lc;
+
+			foreach(lc, cexpr->relationOids)
+				new_summary |= PlanCacheRelidBit(lfirst_oid(lc));
+		}
 	}
+
+	/*
+	 * Install the recomputed summary.  Entries invalidated above lose their
+	 * bits here; they'll be re-added when the plans are revalidated.
+	 */
+	plancache_relid_summary = new_summary;
 }
 
 /*
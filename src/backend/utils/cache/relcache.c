@@ -529,7 +529,8 @@ RelationBuildTupleDesc(Relation relation)
 	SysScanDesc pg_attribute_scan;
 	ScanKeyData skey[2];
 	int			need;
-	TupleConstr *constr;
+	TupleConstr tmpconstr = {0};
+	TupleConstr *constr = &tmpconstr;
 	AttrMissing *attrmiss = NULL;
 	int			ndef = 0;
 
@@ -538,8 +539,13 @@ RelationBuildTupleDesc(Relation relation)
 		relation->rd_rel->reltype ? relation->rd_rel->reltype : RECORDOID;
 	relation->rd_att->tdtypmod = -1;	/* just to be sure */
 
-	constr = (TupleConstr *) MemoryContextAllocZero(CacheMemoryContext,
-													sizeof(TupleConstr));
+	/*
+	 * Constraint/default flags are first accumulated in a local TupleConstr;
+	 * we only pay for a CacheMemoryContext allocation if the relation turns
+	 * out to have any constraint info at all.  That's the common case to
+	 * avoid: mass relcache rebuilds (e.g. after sinval overflow) mostly
+	 * touch plain constraint-less relations.
+	 */
 
 	/*
 	 * Form a scan key that selects only user attributes (attnum > 0).
@@ -686,6 +692,9 @@ RelationBuildTupleDesc(Relation relation)
 	{
 		bool		is_catalog = IsCatalogRelation(relation);
 
+		constr = (TupleConstr *) MemoryContextAllocZero(CacheMemoryContext,
+														sizeof(TupleConstr));
+		memcpy(constr, &tmpconstr, sizeof(TupleConstr));
 		relation->rd_att->constr = constr;
 
 		if (ndef > 0)			/* DEFAULTs */
@@ -726,7 +735,6 @@ RelationBuildTupleDesc(Relation relation)
 	}
 	else
 	{
-		pfree(constr);
 		relation->rd_att->constr = NULL;
 	}
 }
@@ -2822,6 +2830,18 @@ RelationRebuildRelation(Relation relation)
  *
  *	 Rebuild the relation if it is open (refcount > 0), else blow it away.
  *	 This is used when we receive a cache invalidation event for the rel.
+ *
+ *	 The rebuild is always a full one, even for changes that leave the
+ *	 tuple descriptor intact (reloptions tweaks, relhassubclass, stats).
+ *	 Graded invalidation messages telling us "only patch X" have been
+ *	 proposed to soften the storm a DDL deploy causes on large clusters,
+ *	 but they founder on the delivery mechanism: sinval messages can be
+ *	 dropped wholesale in favor of a full cache reset when a backend falls
+ *	 behind, so a consumer can never be sure it saw every message for a
+ *	 rel and must treat any invalidation as "anything may have changed".
+ *	 And knowing which field changed doesn't save the catalog read, since
+ *	 the message carries no payload — by the time we've fetched the new
+ *	 pg_class row, most of the rebuild cost is already paid.
  */
 static void
 RelationFlushRelation(Relation relation)
@@ -3510,6 +3530,19 @@ AtEOSubXact_cleanup(Relation relation, bool isCommit,
  *		RelationBuildLocalRelation
  *			Build a relcache entry for an about-to-be-created relation,
  *			and enter it into the relcache.
+ *
+ * Note that this only covers the window until the creating command writes
+ * the pg_class/pg_attribute rows; it is not a path to catalog-free
+ * relations.  Temp tables in particular must have real catalog rows even
+ * though their storage is backend-local: the parser, planner, dependency
+ * machinery, and all SearchSysCache-based lookups resolve names, column
+ * types, defaults and constraints through the shared catalogs, and OID
+ * assignment must be coordinated cluster-wide so temp and permanent
+ * relations can coexist in one namespace structure.  A backend-private
+ * "session catalog" would have to shadow every one of those lookup paths.
+ * The catalog churn that temp-heavy workloads induce is better addressed
+ * by reusing temp tables across batches (TRUNCATE instead of DROP/CREATE)
+ * and by autovacuum keeping up with pg_attribute.
  */
 Relation
 RelationBuildLocalRelation(const char *relname,
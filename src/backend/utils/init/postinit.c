@@ -34,6 +34,7 @@
 #include "catalog/pg_db_role_setting.h"
 #include "catalog/pg_tablespace.h"
 #include "libpq/auth.h"
+#include "libpq/libpq.h"
 #include "libpq/libpq-be.h"
 #include "mb/pg_wchar.h"
 #include "miscadmin.h"
@@ -633,6 +634,12 @@ BaseInit(void)
 	 */
 	pgaio_init_backend();
 
+	/*
+	 * If connected to a client, let waits on the client socket also wake up
+	 * for AIO completions, now that the IO method is initialized.
+	 */
+	pq_add_aio_completion_event();
+
 	/* Do local initialization of storage and buffer managers */
 	InitSync();
 	smgrinit();
@@ -192,6 +192,7 @@ static const char *const map_old_guc_names[] = {
 	"sort_mem", "work_mem",
 	"vacuum_mem", "maintenance_work_mem",
 	"ssl_ecdh_curve", "ssl_groups",
+	"debug_io_direct", "io_direct",
 	NULL
 };
 
@@ -5965,6 +5966,18 @@ serialize_variable(char **destptr, Size *maxbytes,
 /*
  * SerializeGUCState:
  * Dumps the complete GUC state onto the memory location at start_address.
+ *
+ * This mechanism transfers state to parallel workers, which share the
+ * leader's transaction, snapshot, user identity and lock group.  It is
+ * sometimes proposed as the foundation for migrating an entire session to
+ * a different backend (so that a pooler could multiplex idle sessions),
+ * but the GUC delta is the easy part of that problem: prepared statements
+ * could be re-prepared from their source text, yet temporary tables are
+ * physical relfilenodes tied to this backend's temp namespace, advisory
+ * locks and cursors are owned by this PGPROC, and in-progress transaction
+ * state cannot move at all.  A credible handoff facility would have to
+ * define which of those a session may hold at handoff time; serializing
+ * GUCs alone would produce silently incomplete sessions.
  */
 void
 SerializeGUCState(Size maxsize, char *start_address)
@@ -91,6 +91,7 @@
 #include "tsearch/ts_cache.h"
 #include "utils/builtins.h"
 #include "utils/bytea.h"
+#include "utils/catcache.h"
 #include "utils/float.h"
 #include "utils/guc_hooks.h"
 #include "utils/guc_tables.h"
@@ -374,6 +375,7 @@ static const struct config_enum_entry huge_pages_options[] = {
 static const struct config_enum_entry huge_pages_status_options[] = {
 	{"off", HUGE_PAGES_OFF, false},
 	{"on", HUGE_PAGES_ON, false},
+	{"partial", HUGE_PAGES_PARTIAL, false},
 	{"unknown", HUGE_PAGES_UNKNOWN, false},
 	{NULL, 0, false}
 };
@@ -460,6 +462,9 @@ static const struct config_enum_entry default_toast_compression_options[] = {
 	{"pglz", TOAST_PGLZ_COMPRESSION, false},
 #ifdef  USE_LZ4
 	{"lz4", TOAST_LZ4_COMPRESSION, false},
+#endif
+#ifdef USE_ZSTD
+	{"zstd", TOAST_ZSTD_COMPRESSION, false},
 #endif
 	{NULL, 0, false}
 };
@@ -560,6 +565,8 @@ char	   *external_pid_file;
 
 char	   *application_name;
 
+int			client_send_buffer_size = 8192;
+
 int			tcp_keepalives_idle;
 int			tcp_keepalives_interval;
 int			tcp_keepalives_count;
@@ -593,7 +600,7 @@ static char *datestyle_string;
 static char *server_encoding_string;
 static char *server_version_string;
 static int	server_version_num;
-static char *debug_io_direct_string;
+static char *io_direct_string;
 static char *restrict_nonsystem_relation_kind_string;
 
 #ifdef HAVE_SYSLOG
@@ -205,6 +205,13 @@ enable_timeout(TimeoutId id, TimestampTz now, TimestampTz fin_time,
  * cause us to ask for an interrupt a tick or two later than the nearest
  * timeout, which is no big deal.  Passing a "now" value that's in the future
  * would be bad though.)
+ *
+ * Each backend re-arms its own interval timer here, and the code below
+ * avoids the setitimer() call whenever the pending request is already
+ * close enough.  Centralizing all backends' deadlines into one shared
+ * timer wheel would not remove syscalls, only relocate them: the owner of
+ * the wheel would have to signal the affected backend when a deadline
+ * fires, since only the backend itself can run its timeout callbacks.
  */
 static void
 schedule_alarm(TimestampTz now)
@@ -273,7 +273,7 @@ GenerationContextCreate(MemoryContext parent,
 						parent,
 						name);
 
-	((MemoryContext) set)->mem_allocated = firstBlockSize;
+	MemoryContextTrackBlock((MemoryContext) set, firstBlockSize);
 
 	return (MemoryContext) set;
 }
@@ -388,7 +388,7 @@ GenerationAllocLarge(MemoryContext context, Size size, int flags)
 	/* Make a vchunk covering the new block's header */
 	VALGRIND_MEMPOOL_ALLOC(set, block, Generation_BLOCKHDRSZ);
 
-	context->mem_allocated += blksize;
+	MemoryContextTrackBlock(context, blksize);
 
 	/* block with a single (used) chunk */
 	block->context = set;
@@ -513,7 +513,7 @@ GenerationAllocFromNewBlock(MemoryContext context, Size size, int flags,
 	/* Make a vchunk covering the new block's header */
 	VALGRIND_MEMPOOL_ALLOC(set, block, Generation_BLOCKHDRSZ);
 
-	context->mem_allocated += blksize;
+	MemoryContextTrackBlock(context, blksize);
 
 	/* initialize the new block */
 	GenerationBlockInit(set, block, blksize);
@@ -1163,6 +1163,7 @@ MemoryContextCreate(MemoryContext node,
 	node->parent = parent;
 	node->firstchild = NULL;
 	node->mem_allocated = 0;
+	node->mem_allocated_peak = 0;
 	node->prevchild = NULL;
 	node->name = name;
 	node->ident = NULL;
@@ -596,7 +596,7 @@ SlabAllocFromNewBlock(MemoryContext context, Size size, int flags)
 		VALGRIND_MEMPOOL_ALLOC(slab, block, Slab_BLOCKHDRSZ);
 
 		block->slab = slab;
-		context->mem_allocated += slab->blockSize;
+		MemoryContextTrackBlock(context, slab->blockSize);
 
 		/* use the first chunk in the new block */
 		chunk = SlabBlockGetChunk(slab, block, 0);
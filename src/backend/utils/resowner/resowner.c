@@ -25,6 +25,18 @@
  * When it's time to release the resources, we sort them according to the
  * release-priority of each resource, and release them in that order.
  *
+ * Buffer pins taken inside a long scan are sometimes proposed as another
+ * case to take out of the generic bookkeeping: the scan would register
+ * itself here once and manage its single current pin privately, skipping
+ * the per-page Remember/Forget pair.  The per-pair cost is a linear probe
+ * of the small array, which is also exactly the case the array exists to
+ * make cheap; what the bypass would actually buy is saving that probe, at
+ * the price of a custom release callback per scan type that must replay
+ * the pin-release ordering rules (pins drop before locks at abort) and of
+ * losing the uniform leak check at commit.  So far no profile has shown
+ * the probe itself, as opposed to the pin/unpin around it, to be worth
+ * that.
+ *
  * Local lock references are special, they are not stored in the array or
  * the hash table.  Instead, each resource owner has a separate small cache
  * of locks it owns.  The lock manager has the same information in its local
@@ -84,6 +84,7 @@
 #include "utils/logtape.h"
 #include "utils/memdebug.h"
 #include "utils/memutils.h"
+#include "utils/wait_event.h"
 
 /*
  * A TapeBlockTrailer is stored at the end of each BLCKSZ block.
@@ -330,6 +331,21 @@ ltsReadFillBuffer(LogicalTape *lt)
 		/* Advance to next block, if we have buffer space left */
 	} while (lt->buffer_size - lt->nbytes > BLCKSZ);
 
+	/*
+	 * If the tape continues beyond this buffer, hint the kernel about the
+	 * blocks the next fill will want, so their I/O overlaps with the work
+	 * that consumes the buffer we just filled.  We can't know the whole
+	 * block chain in advance, but thanks to preallocation a run's tail is
+	 * laid out mostly contiguously, so a range hint starting at the next
+	 * block usually covers the right data -- and being advisory, a stale
+	 * hint is cheap.
+	 */
+	if (lt->nbytes > 0 && lt->nextBlockNumber != -1L)
+		BufFilePrefetch(lt->tapeSet->pfile,
+						(lt->nextBlockNumber + lt->offsetBlockNumber) * BLCKSZ,
+						(int64) lt->buffer_size,
+						WAIT_EVENT_BUFFILE_READ);
+
 	return (lt->nbytes > 0);
 }
 
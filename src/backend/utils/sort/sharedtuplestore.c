@@ -84,6 +84,7 @@ struct SharedTuplestoreAccessor
 	char	   *read_buffer;	/* A buffer for loading tuples. */
 	size_t		read_buffer_size;
 	BlockNumber read_next_page; /* Lowest block we'll consider reading. */
+	BlockNumber read_stop_page; /* First block beyond our claimed chunks. */
 
 	/* State for writing. */
 	SharedTuplestoreChunk *write_chunk; /* Buffer for writing. */
@@ -272,6 +273,7 @@ sts_begin_parallel_scan(SharedTuplestoreAccessor *accessor)
 	accessor->read_participant = accessor->participant;
 	accessor->read_file = NULL;
 	accessor->read_next_page = 0;
+	accessor->read_stop_page = 0;
 }
 
 /*
@@ -507,20 +509,49 @@ sts_parallel_scan_next(SharedTuplestoreAccessor *accessor, void *meta_data)
 		/* Find the location of a new chunk to read. */
 		p = &accessor->sts->participants[accessor->read_participant];
 
-		LWLockAcquire(&p->lock, LW_EXCLUSIVE);
-		/* We can skip directly past overflow pages we know about. */
-		if (p->read_page < accessor->read_next_page)
-			p->read_page = accessor->read_next_page;
-		eof = p->read_page >= p->npages;
-		if (!eof)
+		/*
+		 * If an earlier claim still covers more chunks, consume the next one
+		 * without touching the shared read head.
+		 */
+		if (accessor->read_next_page < accessor->read_stop_page)
+		{
+			read_page = accessor->read_next_page;
+			accessor->read_next_page += STS_CHUNK_PAGES;
+			eof = false;
+		}
+		else
 		{
-			/* Claim the next chunk. */
-			read_page = p->read_page;
-			/* Advance the read head for the next reader. */
-			p->read_page += STS_CHUNK_PAGES;
-			accessor->read_next_page = p->read_page;
+			BlockNumber claim_pages;
+
+			LWLockAcquire(&p->lock, LW_EXCLUSIVE);
+			/* We can skip directly past overflow pages we know about. */
+			if (p->read_page < accessor->read_next_page)
+				p->read_page = accessor->read_next_page;
+			eof = p->read_page >= p->npages;
+			if (!eof)
+			{
+				/*
+				 * Claim a run of chunks, guided-self-scheduling style: take
+				 * a bigger bite while plenty of input remains, to cut down
+				 * on lock traffic, but fall back to single chunks as the
+				 * end approaches so a straggler can't get stuck holding a
+				 * large final claim while other workers sit at the barrier.
+				 */
+				claim_pages = (p->npages - p->read_page) /
+					(accessor->sts->nparticipants * 4);
+				claim_pages -= claim_pages % STS_CHUNK_PAGES;
+				claim_pages = Min(claim_pages, 8 * STS_CHUNK_PAGES);
+				claim_pages = Max(claim_pages, STS_CHUNK_PAGES);
+
+				/* Claim the next chunk(s). */
+				read_page = p->read_page;
+				/* Advance the read head for the next reader. */
+				p->read_page += claim_pages;
+				accessor->read_next_page = read_page + STS_CHUNK_PAGES;
+				accessor->read_stop_page = read_page + claim_pages;
+			}
+			LWLockRelease(&p->lock);
 		}
-		LWLockRelease(&p->lock);
 
 		if (!eof)
 		{
@@ -583,6 +614,7 @@ sts_parallel_scan_next(SharedTuplestoreAccessor *accessor, void *meta_data)
 			if (accessor->read_participant == accessor->participant)
 				break;
 			accessor->read_next_page = 0;
+			accessor->read_stop_page = 0;
 
 			/* Go around again, so we can get a chunk from this file. */
 		}
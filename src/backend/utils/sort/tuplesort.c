@@ -87,6 +87,16 @@
  * worker process.  This is then merged.  Worker processes are guaranteed to
  * produce exactly one output run from their partial input.
  *
+ * The leader's merge is single-pass and single-process by design.  Having
+ * workers pair up to pre-merge runs before the leader sees them would shrink
+ * the leader's merge heap from N-way to log(N)-way, but each pre-merge level
+ * rereads and rewrites the entire data set, trading the heap's log2(N)
+ * comparisons per tuple for a full extra I/O pass.  More fundamentally, the
+ * leader's consumer (e.g. the btree load in nbtsort.c) is itself serial, so
+ * every tuple funnels through one process regardless of how the runs were
+ * shaped.  N is bounded by the worker count, which keeps the heap shallow
+ * enough that the merge proper has not been the limiting factor.
+ *
  *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
@@ -1276,7 +1286,36 @@ tuplesort_puttuple_common(Tuplesortstate *state, SortTuple *tuple,
 			 * input tuples than the bound, most input tuples can be discarded
 			 * with just this one comparison.  Note that because we currently
 			 * have the sort direction reversed, we must check for <= not >=.
+			 *
+			 * When the leading key is cached in datum1 we can usually decide
+			 * with one inline comparison of (possibly abbreviated) keys,
+			 * saving the trip through the full comparator; only a tie on the
+			 * leading key needs the tiebreak-capable COMPARETUP.
 			 */
+			if (state->base.haveDatum1 && state->base.sortKeys)
+			{
+				int32		cmp;
+
+				cmp = ApplySortComparator(tuple->datum1, tuple->isnull1,
+										  state->memtuples[0].datum1,
+										  state->memtuples[0].isnull1,
+										  &state->base.sortKeys[0]);
+				if (cmp < 0)
+				{
+					/* new tuple < top of the heap, so we can discard it */
+					free_sort_tuple(state, tuple);
+					CHECK_FOR_INTERRUPTS();
+					break;
+				}
+				else if (cmp > 0)
+				{
+					/* discard top of heap, replacing it with the new tuple */
+					free_sort_tuple(state, &state->memtuples[0]);
+					tuplesort_heap_replace_top(state, tuple);
+					break;
+				}
+				/* leading keys tie; fall through to the full comparison */
+			}
 			if (COMPARETUP(state, tuple, &state->memtuples[0]) <= 0)
 			{
 				/* new tuple <= top of the heap, so we can discard it */
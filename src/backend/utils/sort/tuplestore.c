@@ -42,6 +42,18 @@
  * isn't kept up to date.  We update the appropriate variables using ftell()
  * before switching to the other state or activating a different read pointer.
  *
+ * The spill format is uncompressed MinimalTuples, although spilled data is
+ * often highly compressible.  Before trying to compress it in blocks, note
+ * that the whole module is built on byte addressing of the temp file: read
+ * pointers are BufFile seek positions, reads interleave with appends, and
+ * backward scans walk length words in reverse.  Block compression would
+ * replace those positions with (block, offset) pairs, require decompression
+ * state (and a buffer) per read pointer, and break backward scan, which
+ * window functions rely on.  Compressing beneath BufFile doesn't work
+ * either, as it must stay seekable.  So a compressed spill format means a
+ * redesign of the read-pointer machinery, not a local change to the
+ * writetup/readtup routines.
+ *
  *
  * Portions Copyright (c) 1996-2025, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
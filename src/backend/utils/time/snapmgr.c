@@ -547,6 +547,7 @@ SetTransactionSnapshot(Snapshot sourcesnap, VirtualTransactionId *sourcevxid,
 	/* NB: curcid should NOT be copied, it's a local matter */
 
 	CurrentSnapshot->snapXactCompletionCount = 0;
+	CurrentSnapshot->last_lookup_xid = InvalidTransactionId;
 
 	/*
 	 * Now we have to fix what GetSnapshotData did with MyProc->xmin and
@@ -1108,6 +1109,16 @@ AtEOXact_Snapshot(bool isCommit, bool resetXmin)
  *		Export the snapshot to a file so that other backends can import it.
  *		Returns the token (the file name) that can be used to import this
  *		snapshot.
+ *
+ * Note that a snapshot — exported or otherwise — only makes tuple
+ * visibility consistent; it is not a substitute for the relation locks a
+ * long-running reader like pg_dump takes.  The snapshot does not stop
+ * concurrent DDL from rewriting or unlinking the physical storage that
+ * the snapshot's view of the catalogs still points at (a pinned catalog
+ * xmin would keep the old catalog *rows* visible, not the old
+ * relfilenodes on disk).  Lock-free consistent reads of a changing schema
+ * would need storage-level retention tied to snapshot lifetime, which is
+ * a much bigger contract than snapshot export provides.
  */
 char *
 ExportSnapshot(Snapshot snapshot)
@@ -1514,6 +1525,7 @@ ImportSnapshot(const char *idstr)
 	}
 
 	snapshot.takenDuringRecovery = parseIntFromText("rec:", &filebuf, path);
+	snapshot.last_lookup_xid = InvalidTransactionId;
 
 	/*
 	 * Do some additional sanity checking, just to protect ourselves.  We
@@ -1818,6 +1830,7 @@ RestoreSnapshot(char *start_address)
 	snapshot->takenDuringRecovery = serialized_snapshot.takenDuringRecovery;
 	snapshot->curcid = serialized_snapshot.curcid;
 	snapshot->snapXactCompletionCount = 0;
+	snapshot->last_lookup_xid = InvalidTransactionId;
 
 	/* Copy XIDs, if present. */
 	if (serialized_snapshot.xcnt > 0)
@@ -1866,9 +1879,13 @@ RestoreTransactionSnapshot(Snapshot snapshot, void *source_pgproc)
  * TransactionIdIsCurrentTransactionId first, except when it's known the
  * XID could not be ours anyway.
  */
+static bool XidInMVCCSnapshotSearch(TransactionId xid, Snapshot snapshot);
+
 bool
 XidInMVCCSnapshot(TransactionId xid, Snapshot snapshot)
 {
+	bool		in_snapshot;
+
 	/*
 	 * Make a quick range check to eliminate most XIDs without looking at the
 	 * xip arrays.  Note that this is OK even if we convert a subxact XID to
@@ -1884,6 +1901,28 @@ XidInMVCCSnapshot(TransactionId xid, Snapshot snapshot)
 	if (TransactionIdFollowsOrEquals(xid, snapshot->xmax))
 		return true;
 
+	/*
+	 * Consult the memo of the previous lookup before searching the arrays;
+	 * runs of tuples from a single transaction make repeated lookups of the
+	 * same xid very common.
+	 */
+	if (TransactionIdEquals(xid, snapshot->last_lookup_xid))
+		return snapshot->last_lookup_in_snapshot;
+
+	in_snapshot = XidInMVCCSnapshotSearch(xid, snapshot);
+
+	snapshot->last_lookup_xid = xid;
+	snapshot->last_lookup_in_snapshot = in_snapshot;
+
+	return in_snapshot;
+}
+
+/*
+ * Workhorse for XidInMVCCSnapshot: search the snapshot's xid arrays.
+ */
+static bool
+XidInMVCCSnapshotSearch(TransactionId xid, Snapshot snapshot)
+{
 	/*
 	 * Snapshot information is stored slightly differently in snapshots taken
 	 * during recovery.
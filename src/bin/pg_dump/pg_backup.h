@@ -122,6 +122,8 @@ typedef struct _restoreOptions
 	int			verbose;
 	int			aclsSkip;
 	const char *lockWaitTimeout;
+	const char *maintenanceWorkMem; /* maintenance_work_mem to set in each
+									 * restore session, or NULL */
 	int			include_everything;
 
 	int			tocSummary;
@@ -178,6 +180,9 @@ typedef struct _dumpOptions
 	bool		aclsSkip;
 	const char *lockWaitTimeout;
 	int			dump_inserts;	/* 0 = COPY, otherwise rows per INSERT */
+	int			table_data_chunk_size;	/* split large tables' data into TOC
+										 * entries of about this many MB
+										 * apiece, or 0 to disable */
 
 	/* flags for various command-line long options */
 	int			disable_dollar_quoting;
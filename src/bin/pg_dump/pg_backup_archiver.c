@@ -78,6 +78,7 @@ static bool _tocEntryIsACL(TocEntry *te);
 static void _disableTriggersIfNecessary(ArchiveHandle *AH, TocEntry *te);
 static void _enableTriggersIfNecessary(ArchiveHandle *AH, TocEntry *te);
 static bool is_load_via_partition_root(TocEntry *te);
+static bool is_table_data_chunk(TocEntry *te);
 static void buildTocEntryArrays(ArchiveHandle *AH);
 static void _moveBefore(TocEntry *pos, TocEntry *te);
 static int	_discoverArchiveFormat(ArchiveHandle *AH);
@@ -1010,9 +1011,15 @@ restore_toc_entry(ArchiveHandle *AH, TocEntry *te, bool is_parallel)
 					 * boundaries, risking deadlock and/or loss of previously
 					 * loaded data.  (We assume that all partitions of a
 					 * partitioned table will be treated the same way.)
+					 *
+					 * Nor can we do it when the entry is just one chunk of
+					 * its table's data: the other chunks may be loading
+					 * concurrently, and a TRUNCATE would deadlock against
+					 * them and/or discard their rows.
 					 */
 					use_truncate = is_parallel && te->created &&
-						!is_load_via_partition_root(te);
+						!is_load_via_partition_root(te) &&
+						!is_table_data_chunk(te);
 
 					if (use_truncate)
 					{
@@ -1211,6 +1218,17 @@ is_load_via_partition_root(TocEntry *te)
 	return false;
 }
 
+/*
+ * Detect whether the given TOC entry is one chunk of its table's data, as
+ * produced by pg_dump's --table-data-chunk-size, rather than the whole
+ * table's data.  Such entries are marked with a special comment in te->defn.
+ */
+static bool
+is_table_data_chunk(TocEntry *te)
+{
+	return te->defn && strstr(te->defn, "-- table data chunk") != NULL;
+}
+
 /*
  * This is a routine that is part of the dumper interface, hence the 'Archive*' parameter.
  */
@@ -2006,7 +2024,10 @@ buildTocEntryArrays(ArchiveHandle *AH)
 		 * tableDataId provides the TABLE DATA item's dump ID for each TABLE
 		 * TOC entry that has a DATA item.  We compute this by reversing the
 		 * TABLE DATA item's dependency, knowing that a TABLE DATA item has
-		 * just one dependency and it is the TABLE item.
+		 * just one dependency and it is the TABLE item.  If the table's data
+		 * was split into chunks by --table-data-chunk-size, this remembers
+		 * just one of them; code that must account for every chunk (such as
+		 * repoint_table_dependencies) scans the TOC instead.
 		 */
 		if (strcmp(te->desc, "TABLE DATA") == 0 && te->nDeps > 0)
 		{
@@ -3436,6 +3457,21 @@ _doSetFixedOutputState(ArchiveHandle *AH)
 	else
 		ahprintf(AH, "SET row_security = off;\n");
 
+	/*
+	 * Apply the requested maintenance_work_mem, if any.  This is applied per
+	 * session, so in a parallel restore every worker gets it; it mostly
+	 * benefits the post-data index and constraint builds.
+	 */
+	if (ropt && ropt->maintenanceWorkMem && ropt->maintenanceWorkMem[0] != '\0')
+	{
+		PQExpBuffer buf = createPQExpBuffer();
+
+		appendPQExpBufferStr(buf, "SET maintenance_work_mem = ");
+		appendStringLiteralAHX(buf, ropt->maintenanceWorkMem, AH);
+		ahprintf(AH, "%s;\n", buf->data);
+		destroyPQExpBuffer(buf);
+	}
+
 	/*
 	 * In --transaction-size mode, we should always be in a transaction when
 	 * we begin to restore objects.
@@ -4978,9 +5014,44 @@ repoint_table_dependencies(ArchiveHandle *AH)
 	TocEntry   *te;
 	int			i;
 	DumpId		olddep;
+	int		   *ndataitems;
+	DumpId	  **dataitems;
+
+	/*
+	 * A table's data can be split across several TABLE DATA items if the
+	 * dump was made with --table-data-chunk-size, in which case tableDataId
+	 * remembers only one of them.  Collect the complete set for each table,
+	 * so that a post-data item can be made to wait for every chunk.  For the
+	 * normal case of one data item per table this reduces to tableDataId.
+	 */
+	ndataitems = (int *) pg_malloc0((AH->maxDumpId + 1) * sizeof(int));
+	dataitems = (DumpId **) pg_malloc0((AH->maxDumpId + 1) * sizeof(DumpId *));
+	for (te = AH->toc->next; te != AH->toc; te = te->next)
+	{
+		if (strcmp(te->desc, "TABLE DATA") == 0 && te->nDeps > 0)
+			ndataitems[te->dependencies[0]]++;
+	}
+	for (te = AH->toc->next; te != AH->toc; te = te->next)
+	{
+		if (strcmp(te->desc, "TABLE DATA") == 0 && te->nDeps > 0)
+		{
+			DumpId		tableId = te->dependencies[0];
+
+			if (dataitems[tableId] == NULL)
+			{
+				dataitems[tableId] = (DumpId *)
+					pg_malloc(ndataitems[tableId] * sizeof(DumpId));
+				ndataitems[tableId] = 0;	/* reuse as fill counter */
+			}
+			dataitems[tableId][ndataitems[tableId]++] = te->dumpId;
+		}
+	}
 
 	for (te = AH->toc->next; te != AH->toc; te = te->next)
 	{
+		DumpId	   *extradeps = NULL;
+		int			nextradeps = 0;
+
 		if (te->section != SECTION_POST_DATA)
 			continue;
 		for (i = 0; i < te->nDeps; i++)
@@ -4996,9 +5067,49 @@ repoint_table_dependencies(ArchiveHandle *AH)
 				te->dataLength = Max(te->dataLength, tabledatate->dataLength);
 				pg_log_debug("transferring dependency %d -> %d to %d",
 							 te->dumpId, olddep, tabledataid);
+
+				/*
+				 * For a chunked table, also collect dependencies on the
+				 * chunks other than the one tableDataId points at.
+				 */
+				if (ndataitems[olddep] > 1)
+				{
+					int			j;
+
+					extradeps = (DumpId *)
+						pg_realloc(extradeps,
+								   (nextradeps + ndataitems[olddep]) * sizeof(DumpId));
+					for (j = 0; j < ndataitems[olddep]; j++)
+					{
+						DumpId		chunkid = dataitems[olddep][j];
+
+						if (chunkid == tabledataid)
+							continue;
+						extradeps[nextradeps++] = chunkid;
+						te->dataLength = Max(te->dataLength,
+											 AH->tocsByDumpId[chunkid]->dataLength);
+						pg_log_debug("transferring dependency %d -> %d to %d",
+									 te->dumpId, olddep, chunkid);
+					}
+				}
 			}
 		}
+		if (nextradeps > 0)
+		{
+			te->dependencies = (DumpId *)
+				pg_realloc(te->dependencies,
+						   (te->nDeps + nextradeps) * sizeof(DumpId));
+			memcpy(te->dependencies + te->nDeps, extradeps,
+				   nextradeps * sizeof(DumpId));
+			te->nDeps += nextradeps;
+		}
+		free(extradeps);
 	}
+
+	for (i = 0; i <= AH->maxDumpId; i++)
+		free(dataitems[i]);
+	free(dataitems);
+	free(ndataitems);
 }
 
 /*
@@ -5128,14 +5239,22 @@ mark_create_done(ArchiveHandle *AH, TocEntry *te)
 static void
 inhibit_data_for_failed_table(ArchiveHandle *AH, TocEntry *te)
 {
+	TocEntry   *ted;
+
 	pg_log_info("table \"%s\" could not be created, will not restore its data",
 				te->tag);
 
-	if (AH->tableDataId[te->dumpId] != 0)
+	/*
+	 * Scan the whole TOC rather than using tableDataId, since the table's
+	 * data may be split across several chunk entries.  This is a failure
+	 * path, so the extra cost doesn't matter.
+	 */
+	for (ted = AH->toc->next; ted != AH->toc; ted = ted->next)
 	{
-		TocEntry   *ted = AH->tocsByDumpId[AH->tableDataId[te->dumpId]];
-
-		ted->reqs = 0;
+		if (strcmp(ted->desc, "TABLE DATA") == 0 &&
+			ted->nDeps > 0 &&
+			ted->dependencies[0] == te->dumpId)
+			ted->reqs = 0;
 	}
 }
 
@@ -538,6 +538,7 @@ main(int argc, char **argv)
 		{"exclude-extension", required_argument, NULL, 17},
 		{"sequence-data", no_argument, &dopt.sequence_data, 1},
 		{"restrict-key", required_argument, NULL, 25},
+		{"table-data-chunk-size", required_argument, NULL, 26},
 
 		{NULL, 0, NULL, 0}
 	};
@@ -802,6 +803,13 @@ main(int argc, char **argv)
 				dopt.restrict_key = pg_strdup(optarg);
 				break;
 
+			case 26:			/* table data chunk size */
+				if (!option_parse_int(optarg, "--table-data-chunk-size", 1,
+									  INT_MAX,
+									  &dopt.table_data_chunk_size))
+					exit_nicely(1);
+				break;
+
 			default:
 				/* getopt_long already emitted a complaint */
 				pg_log_error_hint("Try \"%s --help\" for more information.", progname);
@@ -889,6 +897,10 @@ main(int argc, char **argv)
 	if (dopt.do_nothing && dopt.dump_inserts == 0)
 		pg_fatal("option --on-conflict-do-nothing requires option --inserts, --rows-per-insert, or --column-inserts");
 
+	/* Chunked table data relies on COPY, so it can't be mixed with INSERTs */
+	if (dopt.table_data_chunk_size > 0 && dopt.dump_inserts != 0)
+		pg_fatal("option --table-data-chunk-size cannot be used together with --inserts, --rows-per-insert, or --column-inserts");
+
 	/* Identify archive format to emit */
 	archiveFormat = parseArchiveFormat(format, &archiveMode);
 
@@ -1389,6 +1401,9 @@ help(const char *progname)
 			 "                               match at least one entity each\n"));
 	printf(_("  --table-and-children=PATTERN dump only the specified table(s), including\n"
 			 "                               child and partition tables\n"));
+	printf(_("  --table-data-chunk-size=SIZE\n"
+			 "                               split each large table's data into archive\n"
+			 "                               entries of about SIZE megabytes apiece\n"));
 	printf(_("  --use-set-session-authorization\n"
 			 "                               use SET SESSION AUTHORIZATION commands instead of\n"
 			 "                               ALTER OWNER commands to set ownership\n"));
@@ -2916,44 +2931,136 @@ dumpTableData(Archive *fout, const TableDataInfo *tdinfo)
 	 */
 	if (tdinfo->dobj.dump & DUMP_COMPONENT_DATA)
 	{
-		TocEntry   *te;
-
-		te = ArchiveEntry(fout, tdinfo->dobj.catId, tdinfo->dobj.dumpId,
-						  ARCHIVE_OPTS(.tag = tbinfo->dobj.name,
-									   .namespace = tbinfo->dobj.namespace->dobj.name,
-									   .owner = tbinfo->rolname,
-									   .description = "TABLE DATA",
-									   .section = SECTION_DATA,
-									   .createStmt = tdDefn,
-									   .copyStmt = copyStmt,
-									   .deps = &(tbinfo->dobj.dumpId),
-									   .nDeps = 1,
-									   .dumpFn = dumpFn,
-									   .dumpArg = tdinfo));
+		BlockNumber relpages = (BlockNumber) tbinfo->relpages;
+		BlockNumber chunk_pages = 0;
+		int			nchunks = 1;
+		char	   *chunkDefn = NULL;
 
 		/*
-		 * Set the TocEntry's dataLength in case we are doing a parallel dump
-		 * and want to order dump jobs by table size.  We choose to measure
-		 * dataLength in table pages (including TOAST pages) during dump, so
-		 * no scaling is needed.
-		 *
-		 * However, relpages is declared as "integer" in pg_class, and hence
-		 * also in TableInfo, but it's really BlockNumber a/k/a unsigned int.
-		 * Cast so that we get the right interpretation of table sizes
-		 * exceeding INT_MAX pages.
+		 * If --table-data-chunk-size was given, split a large table's data
+		 * into several archive entries, each dumping a range of ctids, so
+		 * that parallel dump and parallel restore can work on one table's
+		 * data concurrently.  We can only do that when using COPY (the chunk
+		 * entries all share the table's plain COPY statement for restore),
+		 * for plain tables, when no other row filter is in use, and against
+		 * servers new enough to turn a ctid range qual into a TID range scan
+		 * rather than N full-table scans.
 		 */
-		te->dataLength = (BlockNumber) tbinfo->relpages;
-		te->dataLength += (BlockNumber) tbinfo->toastpages;
+		if (dopt->table_data_chunk_size > 0 &&
+			dopt->dump_inserts == 0 &&
+			tbinfo->relkind == RELKIND_RELATION &&
+			tdinfo->filtercond == NULL &&
+			fout->remoteVersion >= 140000)
+		{
+			chunk_pages = (BlockNumber)
+				(((uint64) dopt->table_data_chunk_size * 1024 * 1024) / BLCKSZ);
+			if (chunk_pages > 0 && relpages > chunk_pages)
+				nchunks = (int) (((uint64) relpages + chunk_pages - 1) / chunk_pages);
+		}
 
 		/*
-		 * If pgoff_t is only 32 bits wide, the above refinement is useless,
-		 * and instead we'd better worry about integer overflow.  Clamp to
-		 * INT_MAX if the correct result exceeds that.
+		 * Mark chunk entries with a comment in their defn, so that restore
+		 * can tell that each covers only part of its table; see
+		 * is_table_data_chunk().  Keep any partition-root comment first,
+		 * since is_load_via_partition_root() looks for it at the start.
 		 */
-		if (sizeof(te->dataLength) == 4 &&
-			(tbinfo->relpages < 0 || tbinfo->toastpages < 0 ||
-			 te->dataLength < 0))
-			te->dataLength = INT_MAX;
+		if (nchunks > 1)
+		{
+			PQExpBuffer defnBuf = createPQExpBuffer();
+
+			if (tdDefn)
+				appendPQExpBuffer(defnBuf, "%s\n", tdDefn);
+			appendPQExpBufferStr(defnBuf, "-- table data chunk");
+			chunkDefn = defnBuf->data;
+		}
+
+		for (int chunkno = 0; chunkno < nchunks; chunkno++)
+		{
+			TocEntry   *te;
+			const TableDataInfo *chunktd = tdinfo;
+			CatalogId	catId = tdinfo->dobj.catId;
+			DumpId		dumpId = tdinfo->dobj.dumpId;
+			BlockNumber chunklen;
+
+			if (nchunks > 1)
+			{
+				TableDataInfo *newtd;
+				PQExpBuffer condBuf = createPQExpBuffer();
+
+				/*
+				 * Each chunk gets its own TableDataInfo, identical except
+				 * for the filter condition selecting its ctid range.  Leave
+				 * the first chunk's lower bound and the last chunk's upper
+				 * bound open, so that the ranges provably cover the whole
+				 * table even if relpages is stale.
+				 *
+				 * The extra chunks are archive-only: they have no dumpable
+				 * object of their own, just like the ACL and large-object
+				 * entries made elsewhere with createDumpId().  Their lone
+				 * dependency on the table is enough for restore ordering,
+				 * being exactly what an unchunked data entry would have.
+				 */
+				newtd = (TableDataInfo *) pg_malloc(sizeof(TableDataInfo));
+				memcpy(newtd, tdinfo, sizeof(TableDataInfo));
+				if (chunkno > 0)
+				{
+					appendPQExpBuffer(condBuf, "WHERE ctid >= '(%u,0)'",
+									  (BlockNumber) ((uint64) chunkno * chunk_pages));
+					catId = nilCatalogId;
+					dumpId = createDumpId();
+				}
+				if (chunkno < nchunks - 1)
+					appendPQExpBuffer(condBuf, "%s ctid < '(%u,0)'",
+									  chunkno > 0 ? " AND" : "WHERE",
+									  (BlockNumber) ((uint64) (chunkno + 1) * chunk_pages));
+				newtd->filtercond = condBuf->data;
+				chunktd = newtd;
+			}
+
+			te = ArchiveEntry(fout, catId, dumpId,
+							  ARCHIVE_OPTS(.tag = tbinfo->dobj.name,
+										   .namespace = tbinfo->dobj.namespace->dobj.name,
+										   .owner = tbinfo->rolname,
+										   .description = "TABLE DATA",
+										   .section = SECTION_DATA,
+										   .createStmt = nchunks > 1 ? chunkDefn : tdDefn,
+										   .copyStmt = copyStmt,
+										   .deps = &(tbinfo->dobj.dumpId),
+										   .nDeps = 1,
+										   .dumpFn = dumpFn,
+										   .dumpArg = chunktd));
+
+			/*
+			 * Set the TocEntry's dataLength in case we are doing a parallel
+			 * dump and want to order dump jobs by table size.  We choose to
+			 * measure dataLength in table pages (including TOAST pages)
+			 * during dump, so no scaling is needed.  For a chunked table,
+			 * each entry is credited with its own range of pages, plus an
+			 * even share of the TOAST pages.
+			 *
+			 * However, relpages is declared as "integer" in pg_class, and
+			 * hence also in TableInfo, but it's really BlockNumber a/k/a
+			 * unsigned int.  Cast so that we get the right interpretation of
+			 * table sizes exceeding INT_MAX pages.
+			 */
+			if (nchunks > 1)
+				chunklen = (chunkno < nchunks - 1) ? chunk_pages :
+					relpages - (BlockNumber) ((uint64) chunkno * chunk_pages);
+			else
+				chunklen = relpages;
+			te->dataLength = chunklen;
+			te->dataLength += (BlockNumber) tbinfo->toastpages / nchunks;
+
+			/*
+			 * If pgoff_t is only 32 bits wide, the above refinement is
+			 * useless, and instead we'd better worry about integer overflow.
+			 * Clamp to INT_MAX if the correct result exceeds that.
+			 */
+			if (sizeof(te->dataLength) == 4 &&
+				(tbinfo->relpages < 0 || tbinfo->toastpages < 0 ||
+				 te->dataLength < 0))
+				te->dataLength = INT_MAX;
+		}
 	}
 
 	destroyPQExpBuffer(copyBuf);
@@ -17891,6 +17998,9 @@ dumpTableSchema(Archive *fout, const TableInfo *tbinfo)
 					case 'l':
 						cmname = "lz4";
 						break;
+					case 'z':
+						cmname = "zstd";
+						break;
 					default:
 						cmname = NULL;
 						break;
@@ -268,6 +268,8 @@ static bool is_connect;			/* establish connection for each transaction */
 static bool report_per_command = false; /* report per-command latencies,
 										 * retries after errors and failures
 										 * (errors without retrying) */
+static bool latency_histogram = false;	/* collect a latency histogram and
+										 * report percentiles from it */
 static int	main_pid;			/* main process id used in log filename */
 
 /*
@@ -364,6 +366,23 @@ typedef struct SimpleStats
 	double		sum2;			/* sum of squared values */
 } SimpleStats;
 
+/*
+ * Layout of the latency histogram kept under --latency-histogram.
+ *
+ * Buckets are log-linear ("HDR" style): latencies below
+ * 2^HISTOGRAM_SUBBUCKET_BITS microseconds get one bucket per microsecond,
+ * and each further power-of-two range is split into
+ * 2^HISTOGRAM_SUBBUCKET_BITS equal-width buckets, so any recorded value is
+ * off by at most one part in 2^HISTOGRAM_SUBBUCKET_BITS.  The last bucket
+ * collects everything from 2^HISTOGRAM_MAX_POWER microseconds (roughly two
+ * weeks) on up.
+ */
+#define HISTOGRAM_SUBBUCKET_BITS	4
+#define HISTOGRAM_SUBBUCKETS		(1 << HISTOGRAM_SUBBUCKET_BITS)
+#define HISTOGRAM_MAX_POWER			40
+#define HISTOGRAM_BUCKETS \
+	((HISTOGRAM_MAX_POWER - HISTOGRAM_SUBBUCKET_BITS + 1) * HISTOGRAM_SUBBUCKETS)
+
 /*
  * The instr_time type is expensive when dealing with time arithmetic.  Define
  * a type to hold microseconds instead.  Type int64 is good enough for about
@@ -448,6 +467,8 @@ typedef struct StatsData
 									 * specified */
 	SimpleStats latency;
 	SimpleStats lag;
+	int64		hist[HISTOGRAM_BUCKETS];	/* latency histogram, filled only
+											 * under --latency-histogram */
 } StatsData;
 
 /*
@@ -960,6 +981,7 @@ usage(void)
 		   "  --continue-on-error      continue running after an SQL error\n"
 		   "  --exit-on-abort          exit when any client is aborted\n"
 		   "  --failures-detailed      report the failures grouped by basic types\n"
+		   "  --latency-histogram      report latency percentiles from a histogram\n"
 		   "  --log-prefix=PREFIX      prefix for transaction time log file\n"
 		   "                           (default: \"pgbench_log\")\n"
 		   "  --max-tries=NUM          max number of tries to run transaction (default: 1)\n"
@@ -1462,6 +1484,47 @@ mergeSimpleStats(SimpleStats *acc, SimpleStats *ss)
 	acc->sum2 += ss->sum2;
 }
 
+/*
+ * Return the histogram bucket that the given latency (in us) falls into.
+ */
+static int
+histogramBucket(double usec)
+{
+	int64		v = (int64) usec;
+	int			exponent;
+	int			bucket;
+
+	if (v < HISTOGRAM_SUBBUCKETS)
+		return (v < 0) ? 0 : (int) v;
+
+	exponent = pg_leftmost_one_pos64(v);
+	bucket = (exponent - HISTOGRAM_SUBBUCKET_BITS + 1) * HISTOGRAM_SUBBUCKETS +
+		(int) ((v >> (exponent - HISTOGRAM_SUBBUCKET_BITS)) &
+			   (HISTOGRAM_SUBBUCKETS - 1));
+	return Min(bucket, HISTOGRAM_BUCKETS - 1);
+}
+
+/*
+ * Return the midpoint latency (in us) of the given histogram bucket, for use
+ * as the reported value for anything that fell into it.
+ */
+static double
+histogramBucketMidpoint(int bucket)
+{
+	int			exponent;
+	int64		width;
+	int64		lower;
+
+	if (bucket < HISTOGRAM_SUBBUCKETS)
+		return bucket + 0.5;
+
+	exponent = HISTOGRAM_SUBBUCKET_BITS + bucket / HISTOGRAM_SUBBUCKETS - 1;
+	width = INT64CONST(1) << (exponent - HISTOGRAM_SUBBUCKET_BITS);
+	lower = (INT64CONST(1) << exponent) +
+		(bucket % HISTOGRAM_SUBBUCKETS) * width;
+	return lower + width / 2.0;
+}
+
 /*
  * Initialize a StatsData struct to mostly zeroes, with its start time set to
  * the given value.
@@ -1479,6 +1542,7 @@ initStats(StatsData *sd, pg_time_usec_t start)
 	sd->other_sql_failures = 0;
 	initSimpleStats(&sd->latency);
 	initSimpleStats(&sd->lag);
+	memset(sd->hist, 0, sizeof(sd->hist));
 }
 
 /*
@@ -1514,6 +1578,9 @@ accumStats(StatsData *stats, bool skipped, double lat, double lag,
 
 			addToSimpleStats(&stats->latency, lat);
 
+			if (latency_histogram)
+				stats->hist[histogramBucket(lat)]++;
+
 			/* and possibly the same for schedule lag */
 			if (throttle_delay)
 				addToSimpleStats(&stats->lag, lag);
@@ -4802,7 +4869,7 @@ processXactStats(TState *thread, CState *st, pg_time_usec_t *now,
 	double		latency = 0.0,
 				lag = 0.0;
 	bool		detailed = progress || throttle_delay || latency_limit ||
-		use_log || per_script_stats;
+		use_log || per_script_stats || latency_histogram;
 
 	if (detailed && !skipped && st->estatus == ESTATUS_NO_ERROR)
 	{
@@ -6462,6 +6529,39 @@ printSimpleStats(const char *prefix, SimpleStats *ss)
 	}
 }
 
+/*
+ * Report latency percentiles computed from the histogram collected under
+ * --latency-histogram.  The reported values are bucket midpoints, so they
+ * are approximate; see the HISTOGRAM_* constants for the bucket layout.
+ */
+static void
+printHistogramPercentiles(const char *prefix, const StatsData *stats)
+{
+	static const double percentiles[] = {50.0, 90.0, 95.0, 99.0, 99.9};
+	int64		total = 0;
+	int64		seen = 0;
+	int			bucket = 0;
+
+	for (int i = 0; i < HISTOGRAM_BUCKETS; i++)
+		total += stats->hist[i];
+
+	if (total == 0)
+		return;
+
+	/* percentiles[] ascends, so each scan resumes where the last stopped */
+	for (int i = 0; i < lengthof(percentiles); i++)
+	{
+		int64		threshold = (int64) ceil(total * percentiles[i] / 100.0);
+
+		while (bucket < HISTOGRAM_BUCKETS - 1 &&
+			   seen + stats->hist[bucket] < threshold)
+			seen += stats->hist[bucket++];
+
+		printf("%s %gth percentile = %.3f ms\n", prefix, percentiles[i],
+			   0.001 * histogramBucketMidpoint(bucket));
+	}
+}
+
 /* print version banner */
 static void
 printVersion(PGconn *con)
@@ -6576,8 +6676,12 @@ printResults(StatsData *total,
 			   latency_limit / 1000.0, latency_late, total->cnt,
 			   (total->cnt > 0) ? 100.0 * latency_late / total->cnt : 0.0);
 
-	if (throttle_delay || progress || latency_limit)
+	if (throttle_delay || progress || latency_limit || latency_histogram)
+	{
 		printSimpleStats("latency", &total->latency);
+		if (latency_histogram)
+			printHistogramPercentiles("latency", total);
+	}
 	else
 	{
 		/* no measurement, show average latency computed from run time */
@@ -6686,6 +6790,8 @@ printResults(StatsData *total,
 
 				}
 				printSimpleStats(" - latency", &sstats->latency);
+				if (latency_histogram)
+					printHistogramPercentiles(" - latency", sstats);
 			}
 
 			/*
@@ -6824,6 +6930,7 @@ main(int argc, char **argv)
 		{"exit-on-abort", no_argument, NULL, 16},
 		{"debug", no_argument, NULL, 17},
 		{"continue-on-error", no_argument, NULL, 18},
+		{"latency-histogram", no_argument, NULL, 19},
 		{NULL, 0, NULL, 0}
 	};
 
@@ -7181,6 +7288,10 @@ main(int argc, char **argv)
 				benchmarking_option_set = true;
 				continue_on_error = true;
 				break;
+			case 19:			/* latency-histogram */
+				benchmarking_option_set = true;
+				latency_histogram = true;
+				break;
 			default:
 				/* getopt_long already emitted a complaint */
 				pg_log_error_hint("Try \"%s --help\" for more information.", progname);
@@ -7530,6 +7641,8 @@ main(int argc, char **argv)
 		/* aggregate thread level stats */
 		mergeSimpleStats(&stats.latency, &thread->stats.latency);
 		mergeSimpleStats(&stats.lag, &thread->stats.lag);
+		for (int k = 0; k < HISTOGRAM_BUCKETS; k++)
+			stats.hist[k] += thread->stats.hist[k];
 		stats.cnt += thread->stats.cnt;
 		stats.skipped += thread->stats.skipped;
 		stats.retries += thread->stats.retries;
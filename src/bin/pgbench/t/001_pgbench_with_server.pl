@@ -1490,6 +1490,18 @@ $node->pgbench(
 	[qr{^$}],
 	'pgbench throttling');
 
+# latency histogram
+$node->pgbench(
+	'-t 10 -S -n --latency-histogram',
+	0,
+	[
+		qr{processed: 10/10},
+		qr{latency 50th percentile = \d+\.\d+ ms},
+		qr{latency 99\.9th percentile = \d+\.\d+ ms}
+	],
+	[qr{^$}],
+	'pgbench latency histogram');
+
 $node->pgbench(
 
 	# given the expected rate and the 2 ms tx duration, at most one is executed
@@ -1076,6 +1076,67 @@ pg_ascii_verifystr(const unsigned char *s, int len)
 		return nullpos - s;
 }
 
+/*
+ * Workhorse for the verifystr functions of the encodings that are strict
+ * supersets of ASCII, i.e. all the supported client/server encodings except
+ * UTF-8 (which has its own, smarter implementation below).
+ *
+ * ASCII-only input is accepted a vector's worth at a time; is_valid_ascii()
+ * also rejects zero bytes, so no '\0' can hide in a chunk accepted that way.
+ * When a chunk fails the vector check, we verify characters one at a time
+ * until we have consumed it, rather than retrying the vector check at every
+ * character boundary within a run of multibyte characters.
+ *
+ * The indirect calls to "verifychar" don't cost much here: with ASCII
+ * handled in bulk above them, they are only reached for non-ASCII input,
+ * and compilers are typically able to specialize this function for each
+ * caller's constant function pointer anyway.
+ */
+static int
+pg_ascii_superset_verifystr(const unsigned char *s, int len,
+							mbchar_verifier verifychar)
+{
+	const unsigned char *start = s;
+
+	while (len > 0)
+	{
+		const unsigned char *chunk_end;
+
+		/* fast path when we can read a whole vector of ASCII characters */
+		if (len >= (int) sizeof(Vector8) && is_valid_ascii(s, sizeof(Vector8)))
+		{
+			s += sizeof(Vector8);
+			len -= sizeof(Vector8);
+			continue;
+		}
+
+		/* verify characters singly until the failed chunk is consumed */
+		chunk_end = s + sizeof(Vector8);
+		do
+		{
+			int			l;
+
+			/* fast path for ASCII-subset characters */
+			if (!IS_HIGHBIT_SET(*s))
+			{
+				if (*s == '\0')
+					return s - start;
+				l = 1;
+			}
+			else
+			{
+				l = (*verifychar) (s, len);
+				if (l == -1)
+					return s - start;
+			}
+			s += l;
+			len -= l;
+		} while (len > 0 && s < chunk_end);
+	}
+
+	return s - start;
+}
+
 #define IS_EUC_RANGE_VALID(c)	((c) >= 0xa1 && (c) <= 0xfe)
 
 static int
@@ -1136,30 +1197,7 @@ pg_eucjp_verifychar(const unsigned char *s, int len)
 static int
 pg_eucjp_verifystr(const unsigned char *s, int len)
 {
-	const unsigned char *start = s;
-
-	while (len > 0)
-	{
-		int			l;
-
-		/* fast path for ASCII-subset characters */
-		if (!IS_HIGHBIT_SET(*s))
-		{
-			if (*s == '\0')
-				break;
-			l = 1;
-		}
-		else
-		{
-			l = pg_eucjp_verifychar(s, len);
-			if (l == -1)
-				break;
-		}
-		s += l;
-		len -= l;
-	}
-
-	return s - start;
+	return pg_ascii_superset_verifystr(s, len, pg_eucjp_verifychar);
 }
 
 static int
@@ -1194,30 +1232,7 @@ pg_euckr_verifychar(const unsigned char *s, int len)
 static int
 pg_euckr_verifystr(const unsigned char *s, int len)
 {
-	const unsigned char *start = s;
-
-	while (len > 0)
-	{
-		int			l;
-
-		/* fast path for ASCII-subset characters */
-		if (!IS_HIGHBIT_SET(*s))
-		{
-			if (*s == '\0')
-				break;
-			l = 1;
-		}
-		else
-		{
-			l = pg_euckr_verifychar(s, len);
-			if (l == -1)
-				break;
-		}
-		s += l;
-		len -= l;
-	}
-
-	return s - start;
+	return pg_ascii_superset_verifystr(s, len, pg_euckr_verifychar);
 }
 
 /* EUC-CN byte sequences are exactly same as EUC-KR */
@@ -1277,30 +1292,7 @@ pg_euctw_verifychar(const unsigned char *s, int len)
 static int
 pg_euctw_verifystr(const unsigned char *s, int len)
 {
-	const unsigned char *start = s;
-
-	while (len > 0)
-	{
-		int			l;
-
-		/* fast path for ASCII-subset characters */
-		if (!IS_HIGHBIT_SET(*s))
-		{
-			if (*s == '\0')
-				break;
-			l = 1;
-		}
-		else
-		{
-			l = pg_euctw_verifychar(s, len);
-			if (l == -1)
-				break;
-		}
-		s += l;
-		len -= l;
-	}
-
-	return s - start;
+	return pg_ascii_superset_verifystr(s, len, pg_euctw_verifychar);
 }
 
 static int
@@ -1330,30 +1322,7 @@ pg_johab_verifychar(const unsigned char *s, int len)
 static int
 pg_johab_verifystr(const unsigned char *s, int len)
 {
-	const unsigned char *start = s;
-
-	while (len > 0)
-	{
-		int			l;
-
-		/* fast path for ASCII-subset characters */
-		if (!IS_HIGHBIT_SET(*s))
-		{
-			if (*s == '\0')
-				break;
-			l = 1;
-		}
-		else
-		{
-			l = pg_johab_verifychar(s, len);
-			if (l == -1)
-				break;
-		}
-		s += l;
-		len -= l;
-	}
-
-	return s - start;
+	return pg_ascii_superset_verifystr(s, len, pg_johab_verifychar);
 }
 
 static int
@@ -1380,30 +1349,7 @@ pg_mule_verifychar(const unsigned char *s, int len)
 static int
 pg_mule_verifystr(const unsigned char *s, int len)
 {
-	const unsigned char *start = s;
-
-	while (len > 0)
-	{
-		int			l;
-
-		/* fast path for ASCII-subset characters */
-		if (!IS_HIGHBIT_SET(*s))
-		{
-			if (*s == '\0')
-				break;
-			l = 1;
-		}
-		else
-		{
-			l = pg_mule_verifychar(s, len);
-			if (l == -1)
-				break;
-		}
-		s += l;
-		len -= l;
-	}
-
-	return s - start;
+	return pg_ascii_superset_verifystr(s, len, pg_mule_verifychar);
 }
 
 static int
@@ -1449,30 +1395,7 @@ pg_sjis_verifychar(const unsigned char *s, int len)
 static int
 pg_sjis_verifystr(const unsigned char *s, int len)
 {
-	const unsigned char *start = s;
-
-	while (len > 0)
-	{
-		int			l;
-
-		/* fast path for ASCII-subset characters */
-		if (!IS_HIGHBIT_SET(*s))
-		{
-			if (*s == '\0')
-				break;
-			l = 1;
-		}
-		else
-		{
-			l = pg_sjis_verifychar(s, len);
-			if (l == -1)
-				break;
-		}
-		s += l;
-		len -= l;
-	}
-
-	return s - start;
+	return pg_ascii_superset_verifystr(s, len, pg_sjis_verifychar);
 }
 
 static int
@@ -1503,30 +1426,7 @@ pg_big5_verifychar(const unsigned char *s, int len)
 static int
 pg_big5_verifystr(const unsigned char *s, int len)
 {
-	const unsigned char *start = s;
-
-	while (len > 0)
-	{
-		int			l;
-
-		/* fast path for ASCII-subset characters */
-		if (!IS_HIGHBIT_SET(*s))
-		{
-			if (*s == '\0')
-				break;
-			l = 1;
-		}
-		else
-		{
-			l = pg_big5_verifychar(s, len);
-			if (l == -1)
-				break;
-		}
-		s += l;
-		len -= l;
-	}
-
-	return s - start;
+	return pg_ascii_superset_verifystr(s, len, pg_big5_verifychar);
 }
 
 static int
@@ -1557,30 +1457,7 @@ pg_gbk_verifychar(const unsigned char *s, int len)
 static int
 pg_gbk_verifystr(const unsigned char *s, int len)
 {
-	const unsigned char *start = s;
-
-	while (len > 0)
-	{
-		int			l;
-
-		/* fast path for ASCII-subset characters */
-		if (!IS_HIGHBIT_SET(*s))
-		{
-			if (*s == '\0')
-				break;
-			l = 1;
-		}
-		else
-		{
-			l = pg_gbk_verifychar(s, len);
-			if (l == -1)
-				break;
-		}
-		s += l;
-		len -= l;
-	}
-
-	return s - start;
+	return pg_ascii_superset_verifystr(s, len, pg_gbk_verifychar);
 }
 
 static int
@@ -1611,30 +1488,7 @@ pg_uhc_verifychar(const unsigned char *s, int len)
 static int
 pg_uhc_verifystr(const unsigned char *s, int len)
 {
-	const unsigned char *start = s;
-
-	while (len > 0)
-	{
-		int			l;
-
-		/* fast path for ASCII-subset characters */
-		if (!IS_HIGHBIT_SET(*s))
-		{
-			if (*s == '\0')
-				break;
-			l = 1;
-		}
-		else
-		{
-			l = pg_uhc_verifychar(s, len);
-			if (l == -1)
-				break;
-		}
-		s += l;
-		len -= l;
-	}
-
-	return s - start;
+	return pg_ascii_superset_verifystr(s, len, pg_uhc_verifychar);
 }
 
 static int
@@ -1671,30 +1525,7 @@ pg_gb18030_verifychar(const unsigned char *s, int len)
 static int
 pg_gb18030_verifystr(const unsigned char *s, int len)
 {
-	const unsigned char *start = s;
-
-	while (len > 0)
-	{
-		int			l;
-
-		/* fast path for ASCII-subset characters */
-		if (!IS_HIGHBIT_SET(*s))
-		{
-			if (*s == '\0')
-				break;
-			l = 1;
-		}
-		else
-		{
-			l = pg_gb18030_verifychar(s, len);
-			if (l == -1)
-				break;
-		}
-		s += l;
-		len -= l;
-	}
-
-	return s - start;
+	return pg_ascii_superset_verifystr(s, len, pg_gb18030_verifychar);
 }
 
 static int
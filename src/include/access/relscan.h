@@ -143,6 +143,15 @@ typedef struct IndexScanDescData
 	bool		xs_want_itup;	/* caller requests index tuples */
 	bool		xs_temp_snap;	/* unregister snapshot at scan end? */
 
+	/*
+	 * Incremented by the index AM each time it reads a new batch of items
+	 * (e.g., a btree leaf page) to be returned by subsequent amgettuple
+	 * calls.  Remains zero in AMs that do not maintain it.  Callers can use
+	 * this to recognize results coming from a single batch; see
+	 * IndexOnlyNext.
+	 */
+	uint64		xs_batch_id;
+
 	/* signaling to index AM about killing index tuples */
 	bool		kill_prior_tuple;	/* last-returned tuple is dead */
 	bool		ignore_killed_tuples;	/* do not return killed entries */
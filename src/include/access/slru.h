@@ -19,9 +19,18 @@
 
 /*
  * To avoid overflowing internal arithmetic and the size_t data type, the
- * number of buffers must not exceed this number.
+ * number of buffers must not exceed this number.  Since lookup and victim
+ * selection only ever examine one bank of SLRU_BANK_SIZE slots, the cache can
+ * be made large without those operations degrading; 8GB allows the multixact
+ * member working set of pathological SELECT FOR SHARE workloads to stay
+ * resident.  On platforms with a 32-bit size_t, 8GB of pages would itself
+ * overflow the shmem size computation, so there the cap stays at 1GB.
  */
+#if SIZEOF_SIZE_T > 4
+#define SLRU_MAX_ALLOWED_BUFFERS (((1024 * 1024 * 1024) / BLCKSZ) * 8)
+#else
 #define SLRU_MAX_ALLOWED_BUFFERS ((1024 * 1024 * 1024) / BLCKSZ)
+#endif
 
 /*
  * Page status codes.  Note that these do not include the "dirty" bit.
@@ -469,6 +469,16 @@ typedef struct TableAmRoutine
 	 * Fetch tuple at `tid` into `slot`, after doing a visibility test
 	 * according to `snapshot`. If a tuple was found and passed the visibility
 	 * test, returns true, false otherwise.
+	 *
+	 * There is no batch variant taking a sorted TID array, although one is
+	 * suggested now and then for TID-clustered index fetches.  Note before
+	 * designing one that per-page pins are already amortized in the paths
+	 * that matter: index fetches keep the current block pinned across calls
+	 * (see IndexFetchHeapData.xs_cbuf), and a fetched tuple's slot holds the
+	 * page pin until the slot is cleared.  What a batch API would save is
+	 * the per-tuple buffer lock/unlock and visibility-test setup, at the
+	 * price of defining cross-AM semantics for slot lifetimes (one slot per
+	 * returned tuple) and for EPQ rechecks that target single TIDs.
 	 */
 	bool		(*tuple_fetch_row_version) (Relation rel,
 											ItemPointer tid,
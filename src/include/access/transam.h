@@ -15,6 +15,9 @@
 #define TRANSAM_H
 
 #include "access/xlogdefs.h"
+#ifndef FRONTEND
+#include "port/atomics.h"
+#endif
 
 
 /* ----------------
@@ -196,11 +199,14 @@ FullTransactionIdAdvance(FullTransactionId *dest)
 #define FirstUnpinnedObjectId	12000
 #define FirstNormalObjectId		16384
 
+#ifndef FRONTEND
+
 /*
  * TransamVariables is a data structure in shared memory that is used to track
  * OID and XID assignment state.  For largely historical reasons, there is
  * just one struct with different fields that are protected by different
- * LWLocks.
+ * LWLocks.  It contains atomics, so it cannot be exposed to frontend code
+ * (which includes this header via pg_control.h).
  *
  * Note: xidWrapLimit and oldestXidDB are not "active" values, but are
  * used just to generate useful messages when xidWarnLimit or xidStopLimit
@@ -244,8 +250,13 @@ typedef struct TransamVariablesData
 	 * the server. This currently is solely used to check whether
 	 * GetSnapshotData() needs to recompute the contents of the snapshot, or
 	 * not. There are likely other users of this.  Always above 1.
+	 *
+	 * This is atomic (though only ever incremented while holding
+	 * ProcArrayLock exclusively) so that GetSnapshotData() can read it
+	 * without holding ProcArrayLock when checking whether a previously
+	 * built snapshot can be reused.
 	 */
-	uint64		xactCompletionCount;
+	pg_atomic_uint64 xactCompletionCount;
 
 	/*
 	 * These fields are protected by XactTruncationLock
@@ -254,6 +265,8 @@ typedef struct TransamVariablesData
 
 } TransamVariablesData;
 
+#endif							/* FRONTEND */
+
 
 
 /*
@@ -330,7 +343,9 @@ TransactionIdFollowsOrEquals(TransactionId id1, TransactionId id2)
 extern bool TransactionStartedDuringRecovery(void);
 
 /* in transam/varsup.c */
+#ifndef FRONTEND
 extern PGDLLIMPORT TransamVariablesData *TransamVariables;
+#endif
 
 /*
  * prototypes for functions in transam/transam.c
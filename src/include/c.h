@@ -407,6 +407,18 @@
 #define unlikely(x) ((x) != 0)
 #endif
 
+/*
+ * Hint the CPU to load the cacheline containing the given address, to hide
+ * memory latency when the access is some distance away.  Expands to nothing
+ * if the compiler has no prefetch intrinsic.  Like likely()/unlikely(), use
+ * sparingly and only where a cache miss is demonstrably hot.
+ */
+#ifdef __GNUC__
+#define pg_prefetch_mem(addr)	__builtin_prefetch(addr)
+#else
+#define pg_prefetch_mem(addr)	((void) 0)
+#endif
+
 /*
  * CppAsString
  *		Convert the argument to a string, using the C preprocessor.
@@ -131,6 +131,15 @@ CATALOG(pg_class,1259,RelationRelationId) BKI_BOOTSTRAP BKI_ROWTYPE_OID(83,Relat
 	/* all multixacts in this rel are >= this; it is really a MultiXactId */
 	TransactionId relminmxid BKI_DEFAULT(1);	/* FirstMultiXactId */
 
+	/* oldest unfrozen XID seen by an interrupted aggressive VACUUM */
+	TransactionId relvacresumexid BKI_DEFAULT(0);
+
+	/* same, for multixacts; it is really a MultiXactId */
+	TransactionId relvacresumemxid BKI_DEFAULT(0);
+
+	/* next block an interrupted aggressive VACUUM would scan; 0 if none */
+	int32		relvacresumeblock BKI_DEFAULT(0);
+
 #ifdef CATALOG_VARLEN			/* variable-length fields start here */
 	/* NOTE: These fields are not present in a relcache entry's rd_rel field. */
 	/* access permissions */
@@ -146,7 +155,7 @@ CATALOG(pg_class,1259,RelationRelationId) BKI_BOOTSTRAP BKI_ROWTYPE_OID(83,Relat
 
 /* Size of fixed part of pg_class tuples, not counting var-length fields */
 #define CLASS_TUPLE_SIZE \
-	 (offsetof(FormData_pg_class,relminmxid) + sizeof(TransactionId))
+	 (offsetof(FormData_pg_class,relvacresumeblock) + sizeof(int32))
 
 /* ----------------
  *		Form_pg_class corresponds to a pointer to a tuple with
@@ -147,6 +147,7 @@ extern TupleHashTable BuildTupleHashTable(PlanState *parent,
 extern TupleHashEntry LookupTupleHashEntry(TupleHashTable hashtable,
 										   TupleTableSlot *slot,
 										   bool *isnew, uint32 *hash);
+extern void PrefetchTupleHashBucket(TupleHashTable hashtable, uint32 hash);
 extern uint32 TupleHashTableHash(TupleHashTable hashtable,
 								 TupleTableSlot *slot);
 extern TupleHashEntry LookupTupleHashEntryHash(TupleHashTable hashtable,
@@ -554,6 +555,8 @@ ExecQualAndReset(ExprState *state, ExprContext *econtext)
 #endif
 
 extern bool ExecCheck(ExprState *state, ExprContext *econtext);
+extern int	ExecQualBatch(ExprState *state, ExprContext *econtext,
+						  TupleTableSlot **slots, int nslots, bool *results);
 
 /*
  * prototypes from functions in execSRF.c
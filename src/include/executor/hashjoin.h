@@ -327,6 +327,10 @@ typedef struct HashJoinTableData
 
 	bool		growEnabled;	/* flag to shut off nbatch increases */
 
+	struct bloom_filter *bloomfilter;	/* filter over inner-side hash
+										 * values, or NULL; see
+										 * nodeHashjoin.c */
+
 	double		totalTuples;	/* # tuples obtained from inner plan */
 	double		partialTuples;	/* # tuples obtained from inner plan by me */
 	double		skewTuples;		/* # tuples inserted into skew tuples */
@@ -319,6 +319,7 @@ typedef struct AggStatePerHashData
 	AttrNumber *hashGrpColIdxInput; /* hash col indices in input slot */
 	AttrNumber *hashGrpColIdxHash;	/* indices in hash table tuples */
 	Agg		   *aggnode;		/* original Agg node, for numGroups etc. */
+	uint32		lookup_hash;	/* scratch: hash of tuple being looked up */
 }			AggStatePerHashData;
 
 
@@ -68,6 +68,9 @@ typedef struct LLVMJitContext
 
 	/* list of handles for code emitted via Orc */
 	List	   *handles;
+
+	/* deform functions already generated in the current module */
+	List	   *deform_cache;
 } LLVMJitContext;
 
 /* type and struct definitions */
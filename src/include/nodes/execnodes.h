@@ -1544,6 +1544,8 @@ typedef struct MergeAppendState
 	SortSupport ms_sortkeys;	/* array of length ms_nkeys */
 	TupleTableSlot **ms_slots;	/* array of length ms_nplans */
 	struct binaryheap *ms_heap; /* binary heap of slot indices */
+	int			ms_runnerup;	/* second-best subplan index, or -1 */
+	int			ms_runlen;		/* # of consecutive wins by current leader */
 	bool		ms_initialized; /* are subplans started? */
 	struct PartitionPruneState *ms_prune_state;
 	Bitmapset  *ms_valid_subplans;
@@ -1752,6 +1754,9 @@ typedef struct IndexScanState
  *		SharedInfo		   parallel worker instrumentation (no leader entry)
  *		TableSlot		   slot for holding tuples fetched from the table
  *		VMBuffer		   buffer in use for visibility map testing, if any
+ *		VisBlockNumber	   heap block whose all-visible status is cached
+ *		VisBatchId		   AM batch in which VisBlockNumber was checked
+ *		VisAllVisible	   cached all-visible status of VisBlockNumber
  *		PscanLen		   size of parallel index-only scan descriptor
  *		NameCStringAttNums attnums of name typed columns to pad to NAMEDATALEN
  *		NameCStringCount   number of elements in the NameCStringAttNums array
@@ -1775,6 +1780,9 @@ typedef struct IndexOnlyScanState
 	SharedIndexScanInstrumentation *ioss_SharedInfo;
 	TupleTableSlot *ioss_TableSlot;
 	Buffer		ioss_VMBuffer;
+	BlockNumber ioss_VisBlockNumber;
+	uint64		ioss_VisBatchId;
+	bool		ioss_VisAllVisible;
 	Size		ioss_PscanLen;
 	AttrNumber *ioss_NameCStringAttNums;
 	int			ioss_NameCStringCount;
@@ -308,6 +308,13 @@ struct PlannerInfo
 	List	   *join_rel_list;
 	struct HTAB *join_rel_hash pg_node_attr(read_write_ignore);
 
+	/*
+	 * Cache of RestrictInfo translations made for child joins, used to avoid
+	 * re-translating the same parent clause each time a child join is visited
+	 * through a different pair of input relations.  NULL until first use.
+	 */
+	struct HTAB *child_rinfo_hash pg_node_attr(read_write_ignore);
+
 	/*
 	 * When doing a dynamic-programming-style join search, join_rel_level[k]
 	 * is a list of all join-relation RelOptInfos of level k, and
@@ -96,6 +96,8 @@ typedef struct StartReplicationCmd
 	TimeLineID	timeline;
 	XLogRecPtr	startpoint;
 	List	   *options;
+	char	   *compression;	/* compression method for physical streaming,
+								 * or NULL */
 } StartReplicationCmd;
 
 
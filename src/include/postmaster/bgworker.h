@@ -118,6 +118,11 @@ extern void RegisterBackgroundWorker(BackgroundWorker *worker);
 extern bool RegisterDynamicBackgroundWorker(BackgroundWorker *worker,
 											BackgroundWorkerHandle **handle);
 
+/* Register a batch of bgworkers from a regular backend */
+extern int	RegisterDynamicBackgroundWorkers(BackgroundWorker *workers,
+											 int nworkers,
+											 BackgroundWorkerHandle **handles);
+
 /* Query the status of a bgworker */
 extern BgwHandleStatus GetBackgroundWorkerPid(BackgroundWorkerHandle *handle,
 											  pid_t *pidp);
@@ -36,6 +36,17 @@
  * LOGICALREP_PROTO_STREAM_PARALLEL_VERSION_NUM is the minimum protocol version
  * where we support applying large streaming transactions in parallel.
  * Introduced in PG16.
+ *
+ * A recurring proposal is a multi-row message that batches consecutive
+ * changes to one relation, amortizing per-message framing and the
+ * OutputPluginPrepareWrite/Write cycle for high-rate change streams.  Like
+ * the capabilities above, that cannot be added by just defining a message
+ * type here: it needs a protocol version bump with negotiation at connect
+ * time, encode/decode support in proto.c, apply-side handling (including
+ * the parallel streaming paths), and a flush rule in pgoutput so batching
+ * never delays a commit record.  Until someone takes that on, per-change
+ * overhead on the subscriber link is mitigated by the walsender's send
+ * buffering, which already coalesces messages into larger writes.
  */
 #define LOGICALREP_PROTO_MIN_VERSION_NUM 1
 #define LOGICALREP_PROTO_VERSION_NUM 1
@@ -668,6 +668,10 @@ struct ReorderBuffer
 	char	   *outbuf;
 	Size		outbufsize;
 
+	/* scratch buffer for (de)compressing spilled changes */
+	char	   *compbuf;
+	Size		compbufsize;
+
 	/* memory accounting */
 	Size		size;
 
@@ -27,6 +27,7 @@
 /* user-settable parameters */
 extern PGDLLIMPORT int wal_receiver_status_interval;
 extern PGDLLIMPORT int wal_receiver_timeout;
+extern PGDLLIMPORT bool wal_receiver_compression;
 extern PGDLLIMPORT bool hot_standby_feedback;
 
 /*
@@ -176,6 +177,7 @@ typedef struct
 		struct
 		{
 			TimeLineID	startpointTLI;	/* Starting timeline */
+			bool		compression;	/* Request lz4-compressed WAL stream */
 		}			physical;
 		struct
 		{
@@ -350,6 +350,9 @@ extern void pgaio_exit_batchmode(void);
 extern void pgaio_submit_staged(void);
 extern bool pgaio_have_staged(void);
 
+extern int	pgaio_completion_fd(void);
+extern void pgaio_process_completions(void);
+
 
 
 /* --------------------------------------------------------------------------------
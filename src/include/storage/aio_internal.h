@@ -328,6 +328,20 @@ typedef struct IoMethodOps
 	 */
 	void		(*wait_one) (PgAioHandle *ioh,
 							 uint64 ref_generation);
+
+	/*
+	 * Return a file descriptor that is readable whenever completions of IOs
+	 * issued by this backend await processing, for use in a WaitEventSet.
+	 * Optional; see pgaio_completion_fd().
+	 */
+	int			(*completion_fd) (void);
+
+	/*
+	 * Process all completions currently ready for this backend, without
+	 * blocking.  Must be provided if completion_fd is.  See
+	 * pgaio_process_completions().
+	 */
+	void		(*process_completions) (void);
 } IoMethodOps;
 
 
@@ -54,6 +54,7 @@ typedef enum
 	HUGE_PAGES_ON,
 	HUGE_PAGES_TRY,				/* only for huge_pages */
 	HUGE_PAGES_UNKNOWN,			/* only for huge_pages_status */
+	HUGE_PAGES_PARTIAL,			/* only for huge_pages_status */
 }			HugePagesType;
 
 /* Possible values for shared_memory_type */
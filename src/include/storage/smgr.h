@@ -46,6 +46,15 @@ typedef struct SMgrRelationData
 	BlockNumber smgr_targblock; /* current insertion target block */
 	BlockNumber smgr_cached_nblocks[MAX_FORKNUM + 1];	/* last known size */
 
+	/*
+	 * Size, in blocks, of the last bulk extension of the main fork performed
+	 * by this backend, or 0 if none.  This lets successive bulk operations
+	 * (e.g. repeated COPYs) resume extending at the size the previous one
+	 * ramped up to, instead of starting over.  Purely a hint; reset along
+	 * with the fields above.
+	 */
+	uint32		smgr_extend_hint;
+
 	/* additional public fields may someday exist here */
 
 	/*
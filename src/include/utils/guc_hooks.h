@@ -49,8 +49,8 @@ extern bool check_commit_ts_buffers(int *newval, void **extra,
 extern const char *show_data_directory_mode(void);
 extern bool check_datestyle(char **newval, void **extra, GucSource source);
 extern void assign_datestyle(const char *newval, void *extra);
-extern bool check_debug_io_direct(char **newval, void **extra, GucSource source);
-extern void assign_debug_io_direct(const char *newval, void *extra);
+extern bool check_io_direct(char **newval, void **extra, GucSource source);
+extern void assign_io_direct(const char *newval, void *extra);
 extern bool check_log_connections(char **newval, void **extra, GucSource source);
 extern void assign_log_connections(const char *newval, void *extra);
 extern bool check_default_table_access_method(char **newval, void **extra,
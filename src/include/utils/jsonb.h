@@ -404,6 +404,12 @@ extern JsonbValue *getKeyJsonValueFromContainer(JsonbContainer *container,
 												JsonbValue *res);
 extern JsonbValue *getIthJsonbValueFromContainer(JsonbContainer *container,
 												 uint32 i);
+extern JsonbValue *getKeyJsonValueFromToastedObject(struct varlena *attr,
+													const char *keyVal,
+													int keyLen,
+													JsonbValue *res);
+extern JsonbValue *getIthJsonbValueFromToastedArray(struct varlena *attr,
+													int element);
 extern JsonbValue *pushJsonbValue(JsonbParseState **pstate,
 								  JsonbIteratorToken seq, JsonbValue *jbval);
 extern JsonbIterator *JsonbIteratorInit(JsonbContainer *container);
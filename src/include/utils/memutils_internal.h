@@ -163,6 +163,24 @@ extern void *MemoryContextAllocationFailure(MemoryContext context, Size size,
 pg_noreturn extern void MemoryContextSizeFailure(MemoryContext context, Size size,
 												 int flags);
 
+/*
+ * MemoryContextTrackBlock
+ *		Account for a newly acquired block and maintain the allocation
+ *		high-water mark.
+ *
+ * Context implementations must call this (rather than touching
+ * mem_allocated directly) wherever they count a new block against the
+ * context, so that mem_allocated_peak stays accurate.  Block releases may
+ * still decrement mem_allocated directly; the peak never moves down.
+ */
+static inline void
+MemoryContextTrackBlock(MemoryContext context, Size blksize)
+{
+	context->mem_allocated += blksize;
+	if (context->mem_allocated > context->mem_allocated_peak)
+		context->mem_allocated_peak = context->mem_allocated;
+}
+
 static inline void
 MemoryContextCheckSize(MemoryContext context, Size size, int flags)
 {
@@ -28,6 +28,16 @@
  * nearly all pages will be hit anyway.  Also, since we sometimes estimate
  * eqsel as 1/num_distinct, we probably want DEFAULT_NUM_DISTINCT to equal
  * 1/DEFAULT_EQ_SEL.
+ *
+ * Replacing these guesses by executing the problem predicate against a
+ * block sample at plan time has been proposed more than once.  Planning is
+ * the wrong place to run user expressions: the predicate may contain
+ * subqueries, volatile or erroring functions, and its evaluation would do
+ * random heap I/O while the planner holds only AccessShareLock and the
+ * result would be baked into cached plans anyway.  The supported answers
+ * are CREATE STATISTICS on expressions, which gives ANALYZE-quality
+ * numbers for exactly these cases, and indexes on the expression, which
+ * provide per-column stats as a side effect.
  */
 
 /* default selectivity estimate for equalities such as "A = b" */
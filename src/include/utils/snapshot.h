@@ -207,6 +207,16 @@ typedef struct SnapshotData
 	 * transactions completed since the last GetSnapshotData().
 	 */
 	uint64		snapXactCompletionCount;
+
+	/*
+	 * Memo of the last XidInMVCCSnapshot() array lookup against this
+	 * snapshot.  Consecutive tuples were often created (or deleted) by the
+	 * same transaction, so remembering one xid and its answer skips most
+	 * searches of the xip/subxip arrays.  last_lookup_xid is
+	 * InvalidTransactionId when there is no memoized lookup.
+	 */
+	TransactionId last_lookup_xid;
+	bool		last_lookup_in_snapshot;
 } SnapshotData;
 
 #endif							/* SNAPSHOT_H */
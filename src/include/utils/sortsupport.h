@@ -151,6 +151,16 @@ typedef struct SortSupportData
 	 * abbreviation is not in play, the core code always checks whether or not
 	 * the opclass has set abbrev_converter.  This is a one way, one time
 	 * message to the opclass.
+	 *
+	 * XXX Abbreviation is inherently single-column: each converter maps one
+	 * attribute to one pass-by-value key.  Packing the leading bytes of
+	 * several sort columns into one abbreviated word — attractive when the
+	 * first column is low-cardinality so its abbreviated keys nearly always
+	 * tie — would need every participating opclass to expose a
+	 * normalization function producing a byte-orderable encoding (including
+	 * NULL, collation, and DESC handling), i.e. the long-discussed key
+	 * normalization work, not just another converter signature.  Until that
+	 * exists, only sortKeys[0] is ever abbreviated.
 	 */
 	bool		abbreviate;
 
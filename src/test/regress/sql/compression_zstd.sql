@@ -0,0 +1,60 @@
+-- Tests for TOAST compression with zstd
+
+SELECT NOT(enumvals @> '{zstd}') AS skip_test FROM pg_settings WHERE
+  name = 'default_toast_compression' \gset
+\if :skip_test
+   \echo '*** skipping TOAST tests with zstd (not supported) ***'
+   \quit
+\endif
+
+CREATE SCHEMA zstd;
+SET search_path TO zstd, public;
+
+\set HIDE_TOAST_COMPRESSION false
+
+-- Ensure we get stable results regardless of the installation's default.
+SET default_toast_compression = 'pglz';
+
+-- test creating table with compression method
+CREATE TABLE cmdata_zstd(f1 TEXT COMPRESSION zstd);
+INSERT INTO cmdata_zstd VALUES(repeat('1234567890', 1004));
+
+-- verify stored compression method in the data
+SELECT pg_column_compression(f1) FROM cmdata_zstd;
+
+-- decompress data slice
+SELECT SUBSTR(f1, 2000, 50) FROM cmdata_zstd;
+
+-- copy to existing table; the stored compression method is kept
+CREATE TABLE cmmove_zstd(f1 text COMPRESSION pglz);
+INSERT INTO cmmove_zstd SELECT * FROM cmdata_zstd;
+SELECT pg_column_compression(f1) FROM cmmove_zstd;
+
+-- test externally stored compressed data
+CREATE OR REPLACE FUNCTION large_val_zstd() RETURNS TEXT LANGUAGE SQL AS
+'select array_agg(fipshash(g::text))::text from generate_series(1, 256) g';
+CREATE TABLE cmdata2 (f1 text COMPRESSION zstd);
+INSERT INTO cmdata2 SELECT large_val_zstd() || repeat('a', 4000);
+SELECT pg_column_compression(f1) FROM cmdata2;
+SELECT SUBSTR(f1, 200, 5) FROM cmdata2;
+DROP TABLE cmdata2;
+DROP FUNCTION large_val_zstd;
+
+-- test default_toast_compression GUC
+SET default_toast_compression = 'zstd';
+CREATE TABLE cmdata3(f1 text);
+INSERT INTO cmdata3 VALUES(repeat('1234567890', 1004));
+SELECT pg_column_compression(f1) FROM cmdata3;
+RESET default_toast_compression;
+
+-- test alter compression method
+ALTER TABLE cmdata_zstd ALTER COLUMN f1 SET COMPRESSION pglz;
+INSERT INTO cmdata_zstd VALUES (repeat('123456789', 4004));
+SELECT pg_column_compression(f1) FROM cmdata_zstd;
+
+-- check data is ok
+SELECT length(f1) FROM cmdata_zstd;
+SELECT length(f1) FROM cmmove_zstd;
+SELECT length(f1) FROM cmdata3;
+
+\set HIDE_TOAST_COMPRESSION true
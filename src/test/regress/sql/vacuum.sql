@@ -405,6 +405,12 @@ VACUUM (BUFFER_USAGE_LIMIT 10000000000) vac_option_tab;
 -- incompatible with VACUUM FULL error
 VACUUM (BUFFER_USAGE_LIMIT '512 kB', FULL) vac_option_tab;
 
+-- SKIP_UNCHANGED option
+ANALYZE (SKIP_UNCHANGED) vac_option_tab;
+VACUUM (ANALYZE, SKIP_UNCHANGED) vac_option_tab;
+-- requires ANALYZE, error
+VACUUM (SKIP_UNCHANGED) vac_option_tab;
+
 -- SKIP_DATABASE_STATS option
 VACUUM (SKIP_DATABASE_STATS) vactst;
 